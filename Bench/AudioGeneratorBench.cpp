@@ -0,0 +1,105 @@
+// ⏱️ BENCH: Biaya masak semua SFX procedural pas startup - AudioGenerator lama vs kernel baru vs cache disk
+// Build: make bench  ->  ./Bench/AudioGeneratorBench [iterasi]
+//
+// "Legacy" = replika GenerateRawWave lama: malloc buffer 1 detik penuh, sinf / rand() per sample,
+// fade, baru dipotong ke durasi resep.
+// "Kernel" = CreateProceduralWave sekarang (buffer pas durasi, fase integer + polinom, tanpa rand()).
+// "Cache" = LoadCachedWave setelah cache terisi (cuma baca file PCM).
+// Selisih bentuk gelombang kernel vs sinf ikut dicetak biar ketahuan kalau polinomnya meleset.
+
+#include "raylib.h"
+#include "Managers/AudioGenerator.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+// --- REPLIKA AUDIO GENERATOR LAMA ---
+static Wave LegacyCreateWave(int type, float frequency, float duration) {
+    int sampleRate = 44100;
+    Wave wave = { 0 };
+    wave.sampleRate = sampleRate;
+    wave.sampleSize = 32;
+    wave.channels = 1;
+    wave.frameCount = sampleRate;
+
+    float* data = (float*)malloc(wave.frameCount * sizeof(float));
+    for (unsigned int i = 0; i < wave.frameCount; i++) {
+        float t = (float)i / sampleRate;
+        if (type == 0) data[i] = (sinf(2.0f * PI * frequency * t) >= 0) ? 0.3f : -0.3f;
+        else if (type == 1) data[i] = (((float)rand() / RAND_MAX * 1.0f) - 0.5f) * 0.5f;
+        else data[i] = sinf(2.0f * PI * frequency * t) * 0.5f;
+    }
+
+    unsigned int targetFrames = (unsigned int)(sampleRate * duration);
+    if (targetFrames < wave.frameCount) wave.frameCount = targetFrames;
+    for (unsigned int i = 0; i < wave.frameCount; i++) {
+        data[i] *= (1.0f - (float)i / wave.frameCount);
+    }
+    wave.data = data;
+    return wave;
+}
+
+template <typename Fn>
+static double TimeMs(int iterations, Fn&& fn) {
+    auto t0 = std::chrono::steady_clock::now();
+    for (int it = 0; it < iterations; it++) fn();
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(t1 - t0).count() / iterations;
+}
+
+int main(int argc, char** argv) {
+    int iterations = (argc >= 2) ? atoi(argv[1]) : 200;
+    if (iterations < 1) iterations = 1;
+    SetTraceLogLevel(LOG_WARNING);
+
+    int count = 0;
+    const AudioGenerator::SoundRecipe* recipes = AudioGenerator::GetRecipes(count);
+
+    // Akurasi: kernel vs rumus sinf lama (noise beda RNG, cuma dicek rentangnya)
+    for (int r = 0; r < count; r++) {
+        const AudioGenerator::SoundRecipe& recipe = recipes[r];
+        Wave legacy = LegacyCreateWave(recipe.type, recipe.frequency, recipe.duration);
+        Wave kernel = AudioGenerator::CreateProceduralWave(recipe.type, recipe.frequency, recipe.duration);
+        const float* a = (const float*)legacy.data;
+        const float* b = (const float*)kernel.data;
+        float maxDiff = 0.0f;
+        int flips = 0;
+        float peak = 0.0f;
+        for (unsigned int i = 0; i < kernel.frameCount && i < legacy.frameCount; i++) {
+            float diff = fabsf(a[i] - b[i]);
+            if (recipe.type == 0 && diff > 0.01f) flips++; // Square: beda tanda pas nol (pembulatan)
+            else if (recipe.type == 2 && diff > maxDiff) maxDiff = diff;
+            if (fabsf(b[i]) > peak) peak = fabsf(b[i]);
+        }
+        printf("%-10s | frames legacy %u kernel %u | peak %.3f | sine max diff %.6f | square flips %d\n",
+               recipe.name, legacy.frameCount, kernel.frameCount, peak, maxDiff, flips);
+        UnloadWave(legacy);
+        UnloadWave(kernel);
+    }
+
+    double legacyMs = TimeMs(iterations, [&]() {
+        for (int r = 0; r < count; r++) UnloadWave(LegacyCreateWave(recipes[r].type, recipes[r].frequency, recipes[r].duration));
+    });
+    double kernelMs = TimeMs(iterations, [&]() {
+        for (int r = 0; r < count; r++) UnloadWave(AudioGenerator::CreateProceduralWave(recipes[r].type, recipes[r].frequency, recipes[r].duration));
+    });
+
+    // Isi cache dulu, lalu ukur baca ulang
+    for (int r = 0; r < count; r++) UnloadWave(AudioGenerator::LoadCachedWave(recipes[r]));
+    int hits = 0;
+    double cacheMs = TimeMs(iterations, [&]() {
+        for (int r = 0; r < count; r++) {
+            bool hit = false;
+            UnloadWave(AudioGenerator::LoadCachedWave(recipes[r], &hit));
+            hits += hit ? 1 : 0;
+        }
+    });
+
+    printf("\n%d resep, %d iterasi\n", count, iterations);
+    printf("Legacy : %8.3f ms / startup\n", legacyMs);
+    printf("Kernel : %8.3f ms / startup (%.1fx)\n", kernelMs, legacyMs / kernelMs);
+    printf("Cache  : %8.3f ms / startup (%.1fx) | hit %d / %d\n", cacheMs, legacyMs / cacheMs, hits, count * iterations);
+    return 0;
+}
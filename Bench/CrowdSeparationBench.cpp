@@ -0,0 +1,88 @@
+// ⏱️ BENCH: Crowd separation (EnemyStore::ApplySeparation) di 500 / 2000 / 5000 musuh
+// Build: make bench  ->  ./Bench/CrowdSeparationBench [iterasi]
+//
+// Horde CubeWalker ngejar player (0,0,0) dari cincin yang luasnya sebanding jumlah musuh,
+// lama-lama numpuk di player = kasus terburuk.
+// Yang dicatat: biaya separation per tick (harus ~linear: ns/musuh kurang lebih konstan)
+// dan jumlah pasangan yang masih numpuk (overlap > 50% radius) dengan vs tanpa separation.
+
+#include "raylib.h"
+#include "raymath.h"
+#include "Enemies/EnemyStore.h"
+#include "Systems/SpatialHashGrid.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+static Vector3 HordePosition(int count) {
+    // Cincin acak di sekitar player, luasnya ikut jumlah musuh (kepadatan awal sama di semua ukuran)
+    float inner = 20.0f;
+    float outer = sqrtf(inner * inner + count * 8.0f / PI);
+    float angle = GetRandomValue(0, 3600) * 0.1f * DEG2RAD;
+    float dist = inner + (outer - inner) * (float)GetRandomValue(0, 1000) / 1000.0f;
+    return { cosf(angle) * dist, 0.0f, sinf(angle) * dist };
+}
+
+// Hitung pasangan yang numpuk parah (jarak < setengah jumlah radius), lewat grid biar cepat
+static int CountStacked(EnemyStore& store, SpatialHashGrid& grid) {
+    std::vector<int> candidates;
+    grid.Clear();
+    for (int i = 0; i < store.Count(); i++) grid.Insert(i, store.position[i], 0.0f);
+    grid.Build();
+
+    int stacked = 0;
+    for (int i = 0; i < store.Count(); i++) {
+        grid.Query(store.position[i], store.radius[i] + 5.0f, candidates);
+        for (int j : candidates) {
+            if (j <= i) continue;
+            float limit = (store.radius[i] + store.radius[j]) * 0.5f;
+            if (Vector3DistanceSqr(store.position[i], store.position[j]) < limit * limit) stacked++;
+        }
+    }
+    return stacked;
+}
+
+int main(int argc, char** argv) {
+    int iterations = (argc > 1) ? atoi(argv[1]) : 300;
+    const float dt = 1.0f / 60.0f;
+    Vector3 playerPos = {0, 0, 0};
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    printf("CrowdSeparationBench: %d ticks per size (CubeWalker horde chasing player)\n", iterations);
+    printf("%8s %12s %12s %16s %16s\n", "enemies", "sep ms/tick", "sep ns/e", "stacked (off)", "stacked (on)");
+
+    for (int count : {500, 2000, 5000}) {
+        EnemyStore with, without;
+        with.Reserve(count);
+        without.Reserve(count);
+
+        SetRandomSeed(99);
+        for (int i = 0; i < count; i++) with.Spawn(EnemyType::CUBE_WALKER, 1, HordePosition(count));
+        SetRandomSeed(99);
+        for (int i = 0; i < count; i++) without.Spawn(EnemyType::CUBE_WALKER, 1, HordePosition(count));
+        with.CommitPending();
+        without.CommitPending();
+
+        SpatialHashGrid grid(4.0f, 4096); // Sama kayak mEnemyGrid di Game
+        double sepNs = 0.0;
+
+        for (int it = 0; it < iterations; it++) {
+            without.UpdateBehaviors(dt, playerPos);
+            with.UpdateBehaviors(dt, playerPos);
+
+            auto t0 = std::chrono::steady_clock::now();
+            with.ApplySeparation(grid, dt);
+            auto t1 = std::chrono::steady_clock::now();
+            sepNs += std::chrono::duration<double, std::nano>(t1 - t0).count();
+        }
+
+        double perTickMs = sepNs / iterations / 1e6;
+        double perEnemyNs = sepNs / ((double)iterations * count);
+        printf("%8d %12.3f %12.1f %16d %16d\n", count, perTickMs, perEnemyNs,
+               CountStacked(without, grid), CountStacked(with, grid));
+    }
+    return 0;
+}
@@ -0,0 +1,254 @@
+// ⏱️ BENCH: Biaya 1 tick musuh (section F) - layout lama vs EnemyStore (SoA)
+// Build: make bench  ->  ./Bench/EnemyTickBench [iterasi]
+//
+// "Legacy" = replika layout lama: vector<unique_ptr<BaseEnemy>>, virtual Update per musuh,
+// field panas kesebar di heap (ada alokasi lain di sela-sela, kayak gem/partikel pas game jalan).
+// "SoA" = EnemyStore::UpdateBehaviors + loop interaksi per row (kontak ke player), persis Game.
+// Horde-nya CubeWalker tier 1 (tipe paling banyak di wave akhir).
+//
+// Tabel kedua = dispatch per musuh di section F+G (pindahan EnemyDispatchBench, yang dulu jalan
+// di atas BaseEnemy): 4x dynamic_cast vs cek type tag / capability bit di hierarki replika,
+// plus versi EnemyStore (scan kolom capabilities). Body-nya murah biar yang keukur dispatch-nya.
+
+#include "raylib.h"
+#include "raymath.h"
+#include "Enemies/EnemyStore.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+// --- REPLIKA LAYOUT LAMA (BaseEnemy + CubeWalker) ---
+class LegacyEnemy {
+public:
+    LegacyEnemy(Vector3 pos) : position(pos), prevPosition(pos), velocity({0, 0, 0}),
+        hp(20.0f), maxHp(20.0f), speed(5.0f), radius(1.2f), tier(1), active(true), xpReward(15), flashTimer(0.0f) {}
+    virtual ~LegacyEnemy() {}
+    virtual void Update(float dt, Vector3 playerPos) = 0;
+    virtual bool CanSplit() const { return false; }
+
+    Vector3 GetPosition() const { return position; }
+    float GetRadius() const { return radius; }
+    bool IsActive() const { return active; }
+
+protected:
+    Vector3 position;
+    Vector3 prevPosition;
+    Vector3 velocity;
+    float hp, maxHp, speed, radius;
+    int tier;
+    bool active;
+    int xpReward;
+    float flashTimer;
+};
+
+class LegacyWalker : public LegacyEnemy {
+public:
+    LegacyWalker(Vector3 pos) : LegacyEnemy(pos), bodyColor(RED), scaleSize(1.0f), canSplitStatus(false) {}
+    void Update(float dt, Vector3 playerPos) override {
+        if (flashTimer > 0) flashTimer -= dt;
+        Vector3 dir = Vector3Subtract(playerPos, position);
+        dir.y = 0;
+        dir = Vector3Normalize(dir);
+        position = Vector3Add(position, Vector3Scale(dir, speed * dt));
+    }
+    bool CanSplit() const override { return canSplitStatus; }
+
+private:
+    Color bodyColor;
+    float scaleSize;
+    bool canSplitStatus;
+};
+
+static Vector3 HordePosition(int i) {
+    return { (float)(i % 100) - 50.0f, 0.0f, (float)(i / 100) - 50.0f + 60.0f };
+}
+
+// --- REPLIKA HIERARKI BUAT DISPATCH (BaseEnemy + type tag / capability dari request tag) ---
+class DispatchEnemy {
+public:
+    DispatchEnemy(EnemyType t, unsigned int caps) : tag(t), capabilities(caps), active(true) {}
+    virtual ~DispatchEnemy() {}
+    EnemyType GetType() const { return tag; }
+    bool HasCapability(unsigned int cap) const { return (capabilities & cap) != 0; }
+    bool IsActive() const { return active; }
+
+private:
+    EnemyType tag;
+    unsigned int capabilities;
+    bool active;
+};
+class DispatchPlain : public DispatchEnemy {
+public:
+    explicit DispatchPlain(EnemyType t) : DispatchEnemy(t, ENEMY_CAP_NONE) {}
+};
+class DispatchShooter : public DispatchEnemy {
+public:
+    DispatchShooter() : DispatchEnemy(EnemyType::SHOOTER, ENEMY_CAP_SHOOTS) {}
+    int BulletCount() const { return bullets; }
+private:
+    int bullets = 1;
+};
+class DispatchExploder : public DispatchEnemy {
+public:
+    DispatchExploder() : DispatchEnemy(EnemyType::EXPLODER, ENEMY_CAP_EXPLODES) {}
+    float GetExplosionRadius() const { return radius; }
+private:
+    float radius = 3.0f;
+};
+class DispatchBoss : public DispatchEnemy {
+public:
+    DispatchBoss() : DispatchEnemy(EnemyType::BOSS, ENEMY_CAP_SHOOTS | ENEMY_CAP_SPAWNS_MINIONS) {}
+    bool ShouldSpawnMinion() const { return false; }
+    int ProjectileCount() const { return projectiles; }
+private:
+    int projectiles = 0;
+};
+
+using DispatchList = std::vector<std::unique_ptr<DispatchEnemy>>;
+
+// Komposisi kira-kira wave akhir: mayoritas walker/charger, sedikit boss
+static EnemyType HordeType(int i) {
+    switch (i % 10) {
+        case 0: case 1: case 2: return EnemyType::CUBE_WALKER;
+        case 3: case 4:         return EnemyType::CHARGER;
+        case 5: case 6:         return EnemyType::SLIME_JUMPER;
+        case 7:                 return EnemyType::SHOOTER;
+        case 8:                 return EnemyType::EXPLODER;
+        default:                return (i % 100 == 9) ? EnemyType::BOSS : EnemyType::CUBE_WALKER;
+    }
+}
+
+static long DispatchDynamicCast(const DispatchList& enemies) {
+    long hits = 0;
+    for (auto& e : enemies) {
+        if (!e->IsActive()) continue;
+        if (DispatchBoss* boss = dynamic_cast<DispatchBoss*>(e.get())) hits += boss->ShouldSpawnMinion() ? 2 : 1;
+        if (DispatchExploder* ex = dynamic_cast<DispatchExploder*>(e.get())) hits += (long)ex->GetExplosionRadius();
+        if (DispatchShooter* sh = dynamic_cast<DispatchShooter*>(e.get())) hits += sh->BulletCount();
+        if (DispatchBoss* boss = dynamic_cast<DispatchBoss*>(e.get())) hits += boss->ProjectileCount() + 1;
+    }
+    return hits;
+}
+
+static long DispatchTypeTag(const DispatchList& enemies) {
+    long hits = 0;
+    for (auto& e : enemies) {
+        if (!e->IsActive()) continue;
+        if (e->HasCapability(ENEMY_CAP_SPAWNS_MINIONS)) hits += static_cast<DispatchBoss*>(e.get())->ShouldSpawnMinion() ? 2 : 1;
+        if (e->HasCapability(ENEMY_CAP_EXPLODES)) hits += (long)static_cast<DispatchExploder*>(e.get())->GetExplosionRadius();
+        if (!e->HasCapability(ENEMY_CAP_SHOOTS)) continue;
+        if (e->GetType() == EnemyType::SHOOTER) hits += static_cast<DispatchShooter*>(e.get())->BulletCount();
+        else if (e->GetType() == EnemyType::BOSS) hits += static_cast<DispatchBoss*>(e.get())->ProjectileCount() + 1;
+    }
+    return hits;
+}
+
+// Versi EnemyStore: cuma baca kolom capabilities / type, gak ada pointer chasing
+static long DispatchStore(const EnemyStore& store) {
+    long hits = 0;
+    for (int i = 0; i < store.Count(); i++) {
+        if (!store.IsActive(i)) continue;
+        if (store.HasCapability(i, ENEMY_CAP_SPAWNS_MINIONS)) hits += 1;
+        if (store.HasCapability(i, ENEMY_CAP_EXPLODES)) hits += 3;
+        if (!store.HasCapability(i, ENEMY_CAP_SHOOTS)) continue;
+        hits += 1; // Shooter: 1 peluru, Boss: 0 peluru + 1 (sama kayak replika)
+    }
+    return hits;
+}
+
+static void RunDispatchBench(int iterations) {
+    printf("\nDispatch (F+G): %d passes per size, horde campuran\n", iterations);
+    printf("%8s %14s %14s %14s %9s\n", "enemies", "dyncast ns/e", "tag ns/e", "store ns/e", "checksum");
+
+    for (int count : {250, 1000, 2000, 5000}) {
+        DispatchList enemies;
+        EnemyStore store;
+        for (int i = 0; i < count; i++) {
+            EnemyType t = HordeType(i);
+            if (t == EnemyType::SHOOTER) enemies.push_back(std::make_unique<DispatchShooter>());
+            else if (t == EnemyType::EXPLODER) enemies.push_back(std::make_unique<DispatchExploder>());
+            else if (t == EnemyType::BOSS) enemies.push_back(std::make_unique<DispatchBoss>());
+            else enemies.push_back(std::make_unique<DispatchPlain>(t));
+
+            if (t == EnemyType::BOSS) store.SpawnBoss(BossType::TANK_BOSS, HordePosition(i), 5);
+            else store.Spawn(t, 1 + (i % 3), HordePosition(i));
+        }
+        store.CommitPending();
+
+        long sumCast = 0, sumTag = 0, sumStore = 0;
+        auto t0 = std::chrono::steady_clock::now();
+        for (int it = 0; it < iterations; it++) sumCast += DispatchDynamicCast(enemies);
+        auto t1 = std::chrono::steady_clock::now();
+        for (int it = 0; it < iterations; it++) sumTag += DispatchTypeTag(enemies);
+        auto t2 = std::chrono::steady_clock::now();
+        for (int it = 0; it < iterations; it++) sumStore += DispatchStore(store);
+        auto t3 = std::chrono::steady_clock::now();
+
+        double samples = (double)iterations * count;
+        printf("%8d %14.2f %14.2f %14.2f %9s\n", count,
+               std::chrono::duration<double, std::nano>(t1 - t0).count() / samples,
+               std::chrono::duration<double, std::nano>(t2 - t1).count() / samples,
+               std::chrono::duration<double, std::nano>(t3 - t2).count() / samples,
+               (sumCast == sumTag && sumTag == sumStore) ? "OK" : "MISMATCH");
+    }
+}
+
+int main(int argc, char** argv) {
+    int iterations = (argc > 1) ? atoi(argv[1]) : 500;
+    const float dt = 1.0f / 60.0f;
+
+    SetTraceLogLevel(LOG_WARNING);
+    SetRandomSeed(1234);
+
+    printf("EnemyTickBench: %d ticks per size (CubeWalker horde, update + contact check)\n", iterations);
+    printf("%8s %14s %14s %9s\n", "enemies", "legacy ns/e", "soa ns/e", "speedup");
+
+    for (int count : {250, 1000, 2000, 5000}) {
+        // --- Legacy setup (alokasi diselingi sampah biar kesebar kayak heap game beneran) ---
+        std::vector<std::unique_ptr<LegacyEnemy>> legacy;
+        std::vector<std::unique_ptr<char[]>> heapNoise;
+        for (int i = 0; i < count; i++) {
+            legacy.push_back(std::make_unique<LegacyWalker>(HordePosition(i)));
+            heapNoise.push_back(std::make_unique<char[]>(64 + (i % 7) * 48));
+        }
+
+        // --- SoA setup ---
+        EnemyStore store;
+        for (int i = 0; i < count; i++) store.Spawn(EnemyType::CUBE_WALKER, 1, HordePosition(i));
+        store.CommitPending();
+
+        Vector3 playerPos = {0, 0, 0};
+        long contactsLegacy = 0, contactsSoa = 0;
+
+        auto t0 = std::chrono::steady_clock::now();
+        for (int it = 0; it < iterations; it++) {
+            for (auto& e : legacy) {
+                if (!e->IsActive()) continue;
+                e->Update(dt, playerPos);
+                if (Vector3Distance(playerPos, e->GetPosition()) < (e->GetRadius() + 0.5f)) contactsLegacy++;
+            }
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        for (int it = 0; it < iterations; it++) {
+            store.UpdateBehaviors(dt, playerPos);
+            for (int i = 0; i < store.Count(); i++) {
+                if (!store.IsActive(i)) continue;
+                float touchDist = store.radius[i] + 0.5f;
+                if (Vector3DistanceSqr(playerPos, store.position[i]) < touchDist * touchDist) contactsSoa++;
+            }
+        }
+        auto t2 = std::chrono::steady_clock::now();
+
+        double samples = (double)iterations * count;
+        double legacyNs = std::chrono::duration<double, std::nano>(t1 - t0).count() / samples;
+        double soaNs = std::chrono::duration<double, std::nano>(t2 - t1).count() / samples;
+        printf("%8d %14.2f %14.2f %8.2fx  (contacts %ld / %ld)\n",
+               count, legacyNs, soaNs, (soaNs > 0.0) ? legacyNs / soaNs : 0.0, contactsLegacy, contactsSoa);
+    }
+
+    RunDispatchBench(iterations);
+    return 0;
+}
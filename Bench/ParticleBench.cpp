@@ -0,0 +1,125 @@
+// ⏱️ BENCH: Biaya 1 tick partikel (update + spawn ulang) - layout lama vs ParticleSystem (SoA)
+// Build: make bench  ->  ./Bench/ParticleBench [iterasi]
+//
+// "Legacy" = replika ParticleSystem lama: vector<Particle> (AoS + flag active), fade alpha di
+// Update, cleanup erase/remove_if, spawn push_back + sin/cos per partikel.
+// "SoA" = ParticleSystem sekarang. Tiap tick partikel yang mati di-spawn ulang biar jumlahnya
+// stabil di target (kayak wave akhir yang ledakannya nyambung terus).
+
+#include "raylib.h"
+#include "raymath.h"
+#include "Managers/ParticleSystem.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// --- REPLIKA PARTICLE SYSTEM LAMA ---
+struct LegacyParticle {
+    Vector3 position;
+    Vector3 velocity;
+    Color color;
+    float size;
+    float life;
+    float maxLife;
+    bool active;
+};
+
+static float LegacyRandomFloat(float min, float max) {
+    return min + ((float)GetRandomValue(0, 10000) / 10000.0f) * (max - min);
+}
+
+static void LegacyUpdate(std::vector<LegacyParticle>& particles, float dt) {
+    float gravity = 35.0f;
+    for (auto& p : particles) {
+        if (!p.active) continue;
+        p.velocity.y -= gravity * dt;
+        p.position = Vector3Add(p.position, Vector3Scale(p.velocity, dt));
+        if (p.position.y < 0) {
+            p.position.y = 0;
+            p.velocity.y *= -0.6f;
+        }
+        p.life -= dt;
+        if (p.life <= 0) {
+            p.active = false;
+        } else {
+            float alpha = p.life / p.maxLife;
+            p.color.a = (unsigned char)(alpha * 255);
+        }
+    }
+    particles.erase(std::remove_if(particles.begin(), particles.end(),
+        [](const LegacyParticle& p){ return !p.active; }), particles.end());
+}
+
+static void LegacySpawn(std::vector<LegacyParticle>& particles, Vector3 center, Color color, int count) {
+    for (int i = 0; i < count; i++) {
+        LegacyParticle p;
+        p.position = center;
+        float theta = LegacyRandomFloat(0, 360) * DEG2RAD;
+        float phi = LegacyRandomFloat(0, 180) * DEG2RAD;
+        float speed = LegacyRandomFloat(5.0f, 15.0f);
+        p.velocity.x = sinf(phi) * cosf(theta) * speed;
+        p.velocity.y = cosf(phi) * speed;
+        p.velocity.z = sinf(phi) * sinf(theta) * speed;
+        p.size = LegacyRandomFloat(0.2f, 0.6f);
+        p.color = color;
+        p.life = LegacyRandomFloat(0.4f, 0.8f);
+        p.maxLife = p.life;
+        p.active = true;
+        particles.push_back(p);
+    }
+}
+
+int main(int argc, char** argv) {
+    int iterations = (argc > 1) ? atoi(argv[1]) : 300;
+    const float dt = 1.0f / 60.0f;
+    const Vector3 center = { 0.0f, 2.0f, 0.0f };
+
+    SetTraceLogLevel(LOG_WARNING);
+    SetRandomSeed(1234);
+
+    printf("ParticleBench: %d ticks per size (update + respawn ke target)\n", iterations);
+    printf("%8s %14s %14s %9s\n", "particles", "legacy ns/p", "soa ns/p", "speedup");
+
+    for (int count : {10000, 100000}) {
+        // --- Legacy (reserve 1000 kayak constructor lama) ---
+        std::vector<LegacyParticle> legacy;
+        legacy.reserve(1000);
+        LegacySpawn(legacy, center, RED, count);
+
+        // --- SoA ---
+        ParticleSystem soa(count);
+        ParticleBurst burst = { center, RED, count };
+        soa.Emit(burst);
+
+        long spawnedLegacy = 0, spawnedSoa = 0;
+
+        auto t0 = std::chrono::steady_clock::now();
+        for (int it = 0; it < iterations; it++) {
+            LegacyUpdate(legacy, dt);
+            int missing = count - (int)legacy.size();
+            LegacySpawn(legacy, center, RED, missing);
+            spawnedLegacy += missing;
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        for (int it = 0; it < iterations; it++) {
+            soa.Update(dt);
+            int missing = count - soa.Count();
+            burst.count = missing;
+            soa.Emit(burst);
+            spawnedSoa += missing;
+        }
+        auto t2 = std::chrono::steady_clock::now();
+
+        double samples = (double)iterations * count;
+        double legacyNs = std::chrono::duration<double, std::nano>(t1 - t0).count() / samples;
+        double soaNs = std::chrono::duration<double, std::nano>(t2 - t1).count() / samples;
+        printf("%8d %14.2f %14.2f %8.2fx  (respawned %ld / %ld, dropped %d)\n",
+               count, legacyNs, soaNs, (soaNs > 0.0) ? legacyNs / soaNs : 0.0,
+               spawnedLegacy, spawnedSoa, soa.Dropped());
+    }
+    return 0;
+}
@@ -1,220 +1,215 @@
 #include "BossEnemy.h"
+#include "EnemyStore.h"
+#include "../Systems/EnemyProjectilePool.h"
 #include "../Utils/MathUtils.h"
 #include "raymath.h"
 #include <cmath>
 #include <algorithm>
 
-BossEnemy::BossEnemy(BossType type, Vector3 startPos, int waveNumber) 
-    : BaseEnemy(4, startPos) {
-    
-    mBossType = type;
-    mPhase = BossPhase::PHASE_1;
-    position = startPos;
-    velocity = {0, 0, 0};
-    active = true;
-    tier = 4;
-    
-    mAttackTimer = 0.0f;
-    mAttackCycle = 0;
-    mIsCharging = false;
-    mShouldSpawnMinion = false;
-    mSummonTimer = 0.0f;
-    mTeleportTimer = 0.0f;
-    mIsTeleporting = false;
-    glowIntensity = 0.0f;
+// Attack patterns (state setter, internal)
+static void UpdatePhase(EnemyStore& s, BossState& boss);
+static void ExecuteAttackPattern(EnemyStore& s, BossState& boss, float dt, Vector3 playerPos);
+static void AttackPattern_Melee(EnemyStore& s, BossState& boss, float dt, Vector3 playerPos);
+static void AttackPattern_Summon(EnemyStore& s, BossState& boss, float dt);
+static void AttackPattern_Barrage(EnemyStore& s, BossState& boss, float dt, Vector3 playerPos);
+static void AttackPattern_Teleport(EnemyStore& s, BossState& boss, float dt, Vector3 playerPos);
+static void AttackPattern_Ultimate(EnemyStore& s, BossState& boss, float dt, Vector3 playerPos);
+
+void BossEnemy::Init(EnemyStore& s, int row, BossType type, int waveNumber) {
+    BossState boss = {};
+    boss.row = row;
+    boss.bossType = type;
+    boss.phase = BossPhase::PHASE_1;
+    boss.attackTimer = 0.0f;
+    boss.attackCycle = 0;
+    boss.isCharging = false;
+    boss.shouldSpawnMinion = false;
+    boss.summonTimer = 0.0f;
+    boss.teleportTimer = 0.0f;
+    boss.isTeleporting = false;
 
     // 🔥 BOSS STATS BASED ON TYPE + WAVE SCALING
     float waveScaling = 1.0f + (waveNumber / 20.0f) * 0.5f;
 
     switch (type) {
         case BossType::TANK_BOSS:
-            hp = 3000 * waveScaling;
-            speed = 3.0f;
-            radius = 4.0f;
-            xpReward = 2000;
-            bodyColor = DARKGRAY;
-            scaleSize = 5.0f;
-            mAttackCooldown = 3.0f;
-            mChargeSpeed = 15.0f;
+            s.hp[row] = 3000 * waveScaling;
+            s.speed[row] = 3.0f;
+            s.radius[row] = 4.0f;
+            s.xpReward[row] = 2000;
+            s.bodyColor[row] = DARKGRAY;
+            s.scaleSize[row] = 5.0f;
+            boss.attackCooldown = 3.0f;
+            boss.chargeSpeed = 15.0f;
             break;
         
         case BossType::SUMMONER_BOSS:
-            hp = 4000 * waveScaling;
-            speed = 4.0f;
-            radius = 3.5f;
-            xpReward = 4000;
-            bodyColor = PURPLE;
-            scaleSize = 4.5f;
-            mAttackCooldown = 5.0f;
+            s.hp[row] = 4000 * waveScaling;
+            s.speed[row] = 4.0f;
+            s.radius[row] = 3.5f;
+            s.xpReward[row] = 4000;
+            s.bodyColor[row] = PURPLE;
+            s.scaleSize[row] = 4.5f;
+            boss.attackCooldown = 5.0f;
             break;
         
         case BossType::ARTILLERY_BOSS:
-            hp = 5000 * waveScaling;
-            speed = 2.5f;
-            radius = 3.0f;
-            xpReward = 6000;
-            bodyColor = ORANGE;
-            scaleSize = 4.0f;
-            mAttackCooldown = 1.5f;
+            s.hp[row] = 5000 * waveScaling;
+            s.speed[row] = 2.5f;
+            s.radius[row] = 3.0f;
+            s.xpReward[row] = 6000;
+            s.bodyColor[row] = ORANGE;
+            s.scaleSize[row] = 4.0f;
+            boss.attackCooldown = 1.5f;
             break;
         
         case BossType::TELEPORTER_BOSS:
-            hp = 6000 * waveScaling;
-            speed = 5.0f;
-            radius = 3.5f;
-            xpReward = 8000;
-            bodyColor = SKYBLUE;
-            scaleSize = 4.5f;
-            mAttackCooldown = 2.0f;
-            mChargeSpeed = 30.0f;
+            s.hp[row] = 6000 * waveScaling;
+            s.speed[row] = 5.0f;
+            s.radius[row] = 3.5f;
+            s.xpReward[row] = 8000;
+            s.bodyColor[row] = SKYBLUE;
+            s.scaleSize[row] = 4.5f;
+            boss.attackCooldown = 2.0f;
+            boss.chargeSpeed = 30.0f;
             break;
         
         case BossType::ULTIMATE_BOSS:
-            hp = 10000 * waveScaling;
-            speed = 6.0f;
-            radius = 5.0f;
-            xpReward = 20000;
-            bodyColor = GOLD;
-            scaleSize = 6.0f;
-            mAttackCooldown = 1.0f;
-            mChargeSpeed = 40.0f;
+            s.hp[row] = 10000 * waveScaling;
+            s.speed[row] = 6.0f;
+            s.radius[row] = 5.0f;
+            s.xpReward[row] = 20000;
+            s.bodyColor[row] = GOLD;
+            s.scaleSize[row] = 6.0f;
+            boss.attackCooldown = 1.0f;
+            boss.chargeSpeed = 40.0f;
             break;
     }
 
-    maxHp = hp;
+    s.maxHp[row] = s.hp[row];
+    s.bosses.push_back(boss);
 }
 
-void BossEnemy::Update(float dt, Vector3 playerPos) {
-    if (!active) return;
+BossState* BossEnemy::FindState(EnemyStore& s, int row) {
+    for (auto& boss : s.bosses) {
+        if (boss.row == row) return &boss;
+    }
+    return nullptr;
+}
 
-    UpdateFlash(dt);
+void BossEnemy::UpdateAll(EnemyStore& s, float dt, Vector3 playerPos) {
+    for (auto& boss : s.bosses) {
+        int row = boss.row;
+        if (row >= s.Count() || !s.active[row]) continue; // Pending / mati
 
-    UpdatePhase();
+        UpdatePhase(s, boss);
 
-    // --- 🔥 MOVEMENT LOGIC (Moved here so it runs every frame) ---
-    float currentSpeed = speed;
+        // --- 🔥 MOVEMENT LOGIC (jalan tiap frame) ---
+        float currentSpeed = s.speed[row];
 
-    // Handle Speed Modifiers
-    if (mIsCharging) {
-        if (mBossType == BossType::TANK_BOSS || 
-            mBossType == BossType::TELEPORTER_BOSS || 
-            mBossType == BossType::ULTIMATE_BOSS) {
-            currentSpeed = mChargeSpeed;
+        // Handle Speed Modifiers
+        if (boss.isCharging) {
+            if (boss.bossType == BossType::TANK_BOSS || 
+                boss.bossType == BossType::TELEPORTER_BOSS || 
+                boss.bossType == BossType::ULTIMATE_BOSS) {
+                currentSpeed = boss.chargeSpeed;
+            }
         }
-    }
 
-    // Move towards player
-    Vector3 dir = Vector3Normalize(Vector3Subtract(playerPos, position));
-    position = Vector3Add(position, Vector3Scale(dir, currentSpeed * dt));
-    // -------------------------------------------------------------
+        // Move towards player
+        Vector3 position = s.position[row];
+        Vector3 dir = Vector3Normalize(Vector3Subtract(playerPos, position));
+        s.position[row] = Vector3Add(position, Vector3Scale(dir, currentSpeed * dt));
 
-    ExecuteAttackPattern(dt, playerPos);
+        ExecuteAttackPattern(s, boss, dt, playerPos);
 
-    // Update projectiles
-    for (auto& p : mProjectiles) {
-        if (!p.active) continue;
-        
-        p.position = Vector3Add(p.position, Vector3Scale(p.direction, p.speed * dt));
-        p.lifeTime -= dt;
-        
-        if (p.lifeTime <= 0 || p.position.y <= 0) {
-            p.active = false;
-        }
+        // Gravity
+        Vector3& pos = s.position[row];
+        if (pos.y > 0) pos.y -= 10.0f * dt;
+        if (pos.y < 0) pos.y = 0;
     }
-
-    mProjectiles.erase(
-        std::remove_if(mProjectiles.begin(), mProjectiles.end(),
-            [](const BossProjectile& p) { return !p.active; }),
-        mProjectiles.end()
-    );
-
-    // Gravity
-    if (position.y > 0) position.y -= 10.0f * dt;
-    if (position.y < 0) position.y = 0;
-
-    // Glow pulse
-    glowIntensity = 0.5f + sinf(GetTime() * 3.0f) * 0.5f;
 }
 
-void BossEnemy::UpdatePhase() {
-    float hpPercent = hp / maxHp;
+static void UpdatePhase(EnemyStore& s, BossState& boss) {
+    int row = boss.row;
+    float hpPercent = s.hp[row] / s.maxHp[row];
     
     if (hpPercent > 0.66f) {
-        mPhase = BossPhase::PHASE_1;
+        boss.phase = BossPhase::PHASE_1;
     } else if (hpPercent > 0.33f) {
-        if (mPhase == BossPhase::PHASE_1) {
-            speed *= 1.3f;
-            mAttackCooldown *= 0.8f;
+        if (boss.phase == BossPhase::PHASE_1) {
+            s.speed[row] *= 1.3f;
+            boss.attackCooldown *= 0.8f;
         }
-        mPhase = BossPhase::PHASE_2;
+        boss.phase = BossPhase::PHASE_2;
     } else {
-        if (mPhase == BossPhase::PHASE_2) {
-            speed *= 1.5f;
-            mAttackCooldown *= 0.6f;
+        if (boss.phase == BossPhase::PHASE_2) {
+            s.speed[row] *= 1.5f;
+            boss.attackCooldown *= 0.6f;
         }
-        mPhase = BossPhase::PHASE_3;
+        boss.phase = BossPhase::PHASE_3;
     }
 }
 
-void BossEnemy::ExecuteAttackPattern(float dt, Vector3 playerPos) {
-    mAttackTimer -= dt;
+static void ExecuteAttackPattern(EnemyStore& s, BossState& boss, float dt, Vector3 playerPos) {
+    boss.attackTimer -= dt;
     
-    if (mAttackTimer > 0) return;
+    if (boss.attackTimer > 0) return;
 
     // Reset timer
-    mAttackTimer = mAttackCooldown;
-    mAttackCycle++;
+    boss.attackTimer = boss.attackCooldown;
+    boss.attackCycle++;
 
-    switch (mBossType) {
+    switch (boss.bossType) {
         case BossType::TANK_BOSS:
-            AttackPattern_Melee(dt, playerPos);
+            AttackPattern_Melee(s, boss, dt, playerPos);
             break;
         case BossType::SUMMONER_BOSS:
-            AttackPattern_Summon(dt);
+            AttackPattern_Summon(s, boss, dt);
             break;
         case BossType::ARTILLERY_BOSS:
-            AttackPattern_Barrage(dt, playerPos);
+            AttackPattern_Barrage(s, boss, dt, playerPos);
             break;
         case BossType::TELEPORTER_BOSS:
-            AttackPattern_Teleport(dt, playerPos);
+            AttackPattern_Teleport(s, boss, dt, playerPos);
             break;
         case BossType::ULTIMATE_BOSS:
-            AttackPattern_Ultimate(dt, playerPos);
+            AttackPattern_Ultimate(s, boss, dt, playerPos);
             break;
     }
 }
 
 // === ATTACK PATTERNS (State Setters) ===
 
-void BossEnemy::AttackPattern_Melee(float dt, Vector3 playerPos) {
+static void AttackPattern_Melee(EnemyStore& s, BossState& boss, float dt, Vector3 playerPos) {
     // Cycle 3 = Charge Mode
-    if (mAttackCycle % 3 == 0) {
-        mIsCharging = true;
+    if (boss.attackCycle % 3 == 0) {
+        boss.isCharging = true;
     } else {
-        mIsCharging = false;
+        boss.isCharging = false;
     }
 }
 
-void BossEnemy::AttackPattern_Summon(float dt) {
-    mShouldSpawnMinion = true;
+static void AttackPattern_Summon(EnemyStore& s, BossState& boss, float dt) {
+    boss.shouldSpawnMinion = true;
     
     // Teleport kiting logic
-    if (mAttackCycle % 2 == 0) {
+    if (boss.attackCycle % 2 == 0) {
         float angle = GetRandomFloat(0, 360) * DEG2RAD;
         float dist = GetRandomFloat(10, 15);
-        position.x += cosf(angle) * dist;
-        position.z += sinf(angle) * dist;
+        s.position[boss.row].x += cosf(angle) * dist;
+        s.position[boss.row].z += sinf(angle) * dist;
     }
 }
 
-void BossEnemy::AttackPattern_Barrage(float dt, Vector3 playerPos) {
-    int bulletCount = (mPhase == BossPhase::PHASE_3) ? 8 : 5;
+static void AttackPattern_Barrage(EnemyStore& s, BossState& boss, float dt, Vector3 playerPos) {
+    int bulletCount = (boss.phase == BossPhase::PHASE_3) ? 8 : 5;
     float spreadAngle = 360.0f / bulletCount;
     
     for (int i = 0; i < bulletCount; i++) {
-        BossProjectile p;
-        p.position = position;
-        p.position.y += radius;
+        EnemyBullet p;
+        p.position = s.position[boss.row];
+        p.position.y += s.radius[boss.row];
         
         float angle = (spreadAngle * i) * DEG2RAD;
         p.direction = {cosf(angle), 0, sinf(angle)};
@@ -222,52 +217,50 @@ void BossEnemy::AttackPattern_Barrage(float dt, Vector3 playerPos) {
         p.speed = 12.0f;
         p.damage = 20.0f;
         p.radius = 0.4f;
-        p.active = true;
         p.lifeTime = 8.0f;
+        p.color = ORANGE;
+        p.fromBoss = true;
         
-        mProjectiles.push_back(p);
+        s.FireBullet(p);
     }
 }
 
-void BossEnemy::AttackPattern_Teleport(float dt, Vector3 playerPos) {
-    if (mAttackCycle % 2 == 0) {
+static void AttackPattern_Teleport(EnemyStore& s, BossState& boss, float dt, Vector3 playerPos) {
+    if (boss.attackCycle % 2 == 0) {
         // Teleport BEHIND player
-        Vector3 toPlayer = Vector3Subtract(position, playerPos);
+        Vector3 toPlayer = Vector3Subtract(s.position[boss.row], playerPos);
         toPlayer = Vector3Normalize(toPlayer);
-        position = Vector3Add(playerPos, Vector3Scale(toPlayer, 10.0f));
+        s.position[boss.row] = Vector3Add(playerPos, Vector3Scale(toPlayer, 10.0f));
         
-        mIsTeleporting = true; // Visual effect
-        mIsCharging = false;   // Reset speed
+        boss.isTeleporting = true; // Visual effect
+        boss.isCharging = false;   // Reset speed
     } else {
         // Activate CHARGE MODE (Movement handled in Update)
-        mIsCharging = true;
-        mIsTeleporting = false;
+        boss.isCharging = true;
+        boss.isTeleporting = false;
     }
 }
 
-void BossEnemy::AttackPattern_Ultimate(float dt, Vector3 playerPos) {
-    int pattern = mAttackCycle % 4;
+static void AttackPattern_Ultimate(EnemyStore& s, BossState& boss, float dt, Vector3 playerPos) {
+    int pattern = boss.attackCycle % 4;
     
     switch (pattern) {
-        case 0: AttackPattern_Barrage(dt, playerPos); break;
-        case 1: AttackPattern_Melee(dt, playerPos); break;
-        case 2: AttackPattern_Summon(dt); break;
-        case 3: AttackPattern_Teleport(dt, playerPos); break;
+        case 0: AttackPattern_Barrage(s, boss, dt, playerPos); break;
+        case 1: AttackPattern_Melee(s, boss, dt, playerPos); break;
+        case 2: AttackPattern_Summon(s, boss, dt); break;
+        case 3: AttackPattern_Teleport(s, boss, dt, playerPos); break;
     }
 }
 
-void BossEnemy::Draw(Model& slimeModel, Model& cubeModel, Model& magnetModel, 
-                     Model& shadowPlane, Camera3D cam, Vector3 playerPos) {
-    if (!active) return;
+void BossEnemy::Draw(EnemyStore& s, int row, Vector3 position, const EnemyDrawContext& ctx) {
+    BossState* boss = FindState(s, row);
+    if (!boss) return;
 
-    // Shadow
-    float shadowScale = radius * 3.0f;
-    DrawModelEx(shadowPlane, {position.x, 0.05f, position.z}, 
-                {0, 1, 0}, 0.0f, {shadowScale, 1.0f, shadowScale}, 
-                ColorAlpha(BLACK, 0.6f));
+    float scaleSize = s.scaleSize[row];
+    Color bodyColor = s.bodyColor[row];
 
     // Rotation
-    Vector3 dir = Vector3Subtract(playerPos, position);
+    Vector3 dir = Vector3Subtract(ctx.playerPos, position);
     float rotationY = atan2f(dir.x, dir.z) * RAD2DEG;
 
     // Body
@@ -277,26 +270,23 @@ void BossEnemy::Draw(Model& slimeModel, Model& cubeModel, Model& magnetModel,
 
     // Phase Colors
     Color currentColor = bodyColor;
-    if (mPhase == BossPhase::PHASE_3) currentColor = RED;
-    else if (mPhase == BossPhase::PHASE_2) currentColor = ColorBrightness(bodyColor, 0.3f);
+    if (boss->phase == BossPhase::PHASE_3) currentColor = RED;
+    else if (boss->phase == BossPhase::PHASE_2) currentColor = ColorBrightness(bodyColor, 0.3f);
 
     // 🔥 FIX: HIT EFFECT LOGIC
-    Color finalColor = GetRenderColor(currentColor);
+    Color finalColor = EnemyFlashColor(currentColor, s.flashTimer[row]);
 
-    // Apply warna (Normal atau Putih)
-    cubeModel.materials[0].maps[MATERIAL_MAP_DIFFUSE].color = finalColor;
-    DrawModelEx(cubeModel, drawPos, {0, 1, 0}, rotationY, scale, WHITE);
-    
-    // ⚠️ WAJIB RESET: Kembalikan warna ke default agar musuh lain tidak ikut berubah
-    cubeModel.materials[0].maps[MATERIAL_MAP_DIFFUSE].color = WHITE;
+    // Warna (Normal atau Putih) ikut per-instance, material gak disentuh
+    s.DrawCubeBody(ctx, EnemyBodyTransform(drawPos, rotationY, scale), finalColor);
 
-    // Glow Aura (Gunakan finalColor agar aura juga ikut kedip/berubah)
+    // Glow Aura (Pulse dihitung di Draw, visual doang)
+    float glowIntensity = 0.5f + sinf(GetTime() * 3.0f) * 0.5f;
     DrawSphere(drawPos, scaleSize * 1.2f, ColorAlpha(currentColor, glowIntensity * 0.3f));
 
-    // HP Bar & Projectiles (Tetap sama)
+    // HP Bar
     Vector3 hpBarPos = drawPos;
     hpBarPos.y += scaleSize + 2.0f;
-    float hpPercent = hp / maxHp;
+    float hpPercent = s.hp[row] / s.maxHp[row];
     float barWidth = 4.0f;
     float barHeight = 0.3f;
     
@@ -305,13 +295,7 @@ void BossEnemy::Draw(Model& slimeModel, Model& cubeModel, Model& magnetModel,
     fillPos.x -= barWidth * 0.5f * (1.0f - hpPercent);
     DrawCube(fillPos, barWidth * hpPercent, barHeight, 0.1f, RED);
 
-    for (const auto& p : mProjectiles) {
-        if (!p.active) continue;
-        DrawSphere(p.position, p.radius, ORANGE);
-        DrawSphereWires(p.position, p.radius, 4, 4, RED);
-    }
-
-    if (mIsTeleporting) {
+    if (boss->isTeleporting) {
         DrawSphere(drawPos, scaleSize * 1.5f, ColorAlpha(SKYBLUE, 0.5f));
     }
-}
\ No newline at end of file
+}
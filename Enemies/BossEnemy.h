@@ -1,7 +1,8 @@
 #pragma once
-#include "BaseEnemy.h"
 #include "raylib.h"
-#include <vector>
+
+class EnemyStore;
+struct EnemyDrawContext;
 
 enum class BossType {
     TANK_BOSS,          // Boss 1 (Wave 20): Tanky, slow, melee
@@ -17,69 +18,36 @@ enum class BossPhase {
     PHASE_3     // HP < 33% (Rage mode)
 };
 
-struct BossProjectile {
-    Vector3 position;
-    Vector3 direction;
-    float speed;
-    float damage;
-    float radius;
-    bool active;
-    float lifeTime;
-};
-
-class BossEnemy : public BaseEnemy {
-public:
-    // hp dan maxHp diwarisi dari BaseEnemy melalui constructor
-    BossEnemy(BossType type, Vector3 startPos, int waveNumber);
-    
-    void Update(float dt, Vector3 playerPos) override;
-    void Draw(Model& slimeModel, Model& cubeModel, Model& magnetModel, 
-              Model& shadowPlane, Camera3D cam, Vector3 playerPos) override;
+// Otak boss (side table di EnemyStore, 1 entry per boss hidup).
+// Data umum (posisi, hp, speed, peluru) tetap di kolom store lewat `row`.
+struct BossState {
+    int row;
+    BossType bossType;
+    BossPhase phase;
 
-    BossType GetBossType() const { return mBossType; }
-    BossPhase GetPhase() const { return mPhase; }
-    std::vector<BossProjectile>& GetProjectiles() { return mProjectiles; }
-    bool ShouldSpawnMinion() const { return mShouldSpawnMinion; }
-    void ConsumeSpawnSignal() { mShouldSpawnMinion = false; }
-
-private:
-    void UpdatePhase();
-    void ExecuteAttackPattern(float dt, Vector3 playerPos);
-    
-    // Attack patterns
-    void AttackPattern_Melee(float dt, Vector3 playerPos);
-    void AttackPattern_Summon(float dt);
-    void AttackPattern_Barrage(float dt, Vector3 playerPos);
-    void AttackPattern_Teleport(float dt, Vector3 playerPos);
-    void AttackPattern_Ultimate(float dt, Vector3 playerPos);
-
-private:
-    BossType mBossType;
-    BossPhase mPhase;
-    
     // Attack state
-    float mAttackTimer;
-    float mAttackCooldown;
-    int mAttackCycle;
-    
+    float attackTimer;
+    float attackCooldown;
+    int attackCycle;
+
     // Movement
-    Vector3 mTargetPos;
-    bool mIsCharging;
-    float mChargeSpeed;
-    
-    // Projectiles
-    std::vector<BossProjectile> mProjectiles;
-    
+    bool isCharging;
+    float chargeSpeed;
+
     // Summoning
-    bool mShouldSpawnMinion;
-    float mSummonTimer;
-    
+    bool shouldSpawnMinion;
+    float summonTimer;
+
     // Teleport
-    float mTeleportTimer;
-    bool mIsTeleporting;
-    
-    // Visuals
-    Color bodyColor;
-    float scaleSize;
-    float glowIntensity;
-};
\ No newline at end of file
+    float teleportTimer;
+    bool isTeleporting;
+};
+
+namespace BossEnemy {
+    void Init(EnemyStore& store, int row, BossType type, int waveNumber);
+    void UpdateAll(EnemyStore& store, float dt, Vector3 playerPos);
+    void Draw(EnemyStore& store, int row, Vector3 position, const EnemyDrawContext& ctx);
+
+    // Cari otak boss dari row (nullptr kalau row bukan boss)
+    BossState* FindState(EnemyStore& store, int row);
+}
@@ -1,139 +1,141 @@
 #include "ChargerEnemy.h"
+#include "EnemyStore.h"
 #include "../Utils/MathUtils.h"
 #include "raymath.h"
 #include <cmath>
 
-ChargerEnemy::ChargerEnemy(int tier, Vector3 startPos) : BaseEnemy(tier, startPos) {
-    this->tier = tier;
-    position = startPos;
-    velocity = {0, 0, 0};
-    active = true;
-    mState = ChargerState::IDLE;
-    mStateTimer = 0.0f;
-    mDashDirection = {0, 0, 0};
+void ChargerEnemy::Init(EnemyStore& s, int row) {
+    int tier = s.tier[row];
+    s.state[row] = (unsigned char)ChargerState::IDLE;
+    s.stateTimer[row] = 0.0f;
+    s.moveDir[row] = {0, 0, 0};
 
     if (tier == 1) {
-        hp = 40;
-        speed = 6.0f;
-        radius = 1.2f;
-        xpReward = 40;
-        bodyColor = PURPLE;
-        scaleSize = 1.2f;
-        mDashSpeed = 4*25.0f;
+        s.hp[row] = 40;
+        s.speed[row] = 6.0f;
+        s.radius[row] = 1.2f;
+        s.xpReward[row] = 40;
+        s.bodyColor[row] = PURPLE;
+        s.scaleSize[row] = 1.2f;
+        s.attackPower[row] = 4*25.0f;
     } 
     else if (tier == 2) {
-        hp = 120;
-        speed = 7.0f;
-        radius = 1.6f;
-        xpReward = 150;
-        bodyColor = VIOLET;
-        scaleSize = 1.6f;
-        mDashSpeed = 4*35.0f;
+        s.hp[row] = 120;
+        s.speed[row] = 7.0f;
+        s.radius[row] = 1.6f;
+        s.xpReward[row] = 150;
+        s.bodyColor[row] = VIOLET;
+        s.scaleSize[row] = 1.6f;
+        s.attackPower[row] = 4*35.0f;
     }
     else {
-        hp = 300;
-        speed = 8.0f;
-        radius = 2.2f;
-        xpReward = 400;
-        bodyColor = MAGENTA;
-        scaleSize = 2.2f;
-        mDashSpeed = 4*45.0f;
+        s.hp[row] = 300;
+        s.speed[row] = 8.0f;
+        s.radius[row] = 2.2f;
+        s.xpReward[row] = 400;
+        s.bodyColor[row] = MAGENTA;
+        s.scaleSize[row] = 2.2f;
+        s.attackPower[row] = 4*45.0f;
     }
 }
 
-void ChargerEnemy::Update(float dt, Vector3 playerPos) {
-    if (!active) return;
-
-    UpdateFlash(dt);
-
-    Vector3 toPlayer = Vector3Subtract(playerPos, position);
-    toPlayer.y = 0;
-    float distToPlayer = Vector3Length(toPlayer);
-
-    switch (mState) {
-        case ChargerState::IDLE: {
-            // Gerak normal ke player
-            Vector3 dir = Vector3Normalize(toPlayer);
-            position = Vector3Add(position, Vector3Scale(dir, speed * dt));
-
-            // Kalau deket (10-20 meter), mulai charge up
-            if (distToPlayer > 7.5f && distToPlayer < 15.0f) {
-                mState = ChargerState::CHARGING_UP;
-                mStateTimer = 0.2f; // Telegraph 1 detik
-                mDashDirection = dir;
+void ChargerEnemy::UpdateBatch(EnemyStore& s, const std::vector<int>& rows, Vector3 playerPos) {
+    for (int row : rows) {
+        if (!s.active[row]) continue;
+        float dt = s.aiDt[row];
+
+        Vector3 position = s.position[row];
+        float& stateTimer = s.stateTimer[row];
+        Vector3& dashDirection = s.moveDir[row];
+        float dashSpeed = s.attackPower[row];
+        ChargerState state = (ChargerState)s.state[row];
+
+        Vector3 toPlayer = Vector3Subtract(playerPos, position);
+        toPlayer.y = 0;
+        float distToPlayer = Vector3Length(toPlayer);
+
+        switch (state) {
+            case ChargerState::IDLE: {
+                // Gerak normal ke player (ikut flow field, dash tetap lurus)
+                Vector3 dir = s.chaseDir[row];
+                position = Vector3Add(position, Vector3Scale(dir, s.speed[row] * dt));
+
+                // Kalau deket (10-20 meter), mulai charge up
+                if (distToPlayer > 7.5f && distToPlayer < 15.0f) {
+                    state = ChargerState::CHARGING_UP;
+                    stateTimer = 0.2f; // Telegraph 1 detik
+                    dashDirection = dir;
+                }
+                break;
             }
-            break;
-        }
 
-        case ChargerState::CHARGING_UP: {
-            // STOP + WARNING VISUAL
-            mStateTimer -= dt;
-            if (mStateTimer <= 0) {
-                mState = ChargerState::DASHING;
-                mStateTimer = 0.16f; 
+            case ChargerState::CHARGING_UP: {
+                // STOP + WARNING VISUAL
+                stateTimer -= dt;
+                if (stateTimer <= 0) {
+                    state = ChargerState::DASHING;
+                    stateTimer = 0.16f; 
+                }
+                break;
             }
-            break;
-        }
-
-        case ChargerState::DASHING: {
-            // DASH SUPER CEPAT
-            position = Vector3Add(position, Vector3Scale(mDashDirection, mDashSpeed * dt));
-            
-            mStateTimer -= dt;
-            if (mStateTimer <= 0) {
-                mState = ChargerState::COOLDOWN;
-                mStateTimer = 1.2f; // Cooldown 2 detik
-            }
-            break;
-        }
 
-        case ChargerState::COOLDOWN: {
-            // 🔥 LOGIC PERLAMBATAN (DRIFTING)
-            // 0.5 detik pertama cooldown dipakai untuk pengereman
-            float totalCooldown = 2.0f;
-            float slideDuration = 0.5f; 
-            float timeInCooldown = totalCooldown - mStateTimer;
-
-            if (timeInCooldown < slideDuration) {
-                // Hitung faktor perlambatan (Dari 1.0 ke 0.0)
-                float slowdownFactor = 1.0f - (timeInCooldown / slideDuration);
+            case ChargerState::DASHING: {
+                // DASH SUPER CEPAT
+                position = s.SweepMove(position, Vector3Scale(dashDirection, dashSpeed * dt), s.radius[row]);
                 
-                // Gunakan EaseOut (Kuadratik) biar terasa berat
-                slowdownFactor = slowdownFactor * slowdownFactor; 
-
-                // Speed awal pengereman = 40% dari dash speed
-                float currentSlideSpeed = mDashSpeed * 0.4f * slowdownFactor;
-
-                // Terapkan gerakan sisa momentum
-                position = Vector3Add(position, Vector3Scale(mDashDirection, currentSlideSpeed * dt));
+                stateTimer -= dt;
+                if (stateTimer <= 0) {
+                    state = ChargerState::COOLDOWN;
+                    stateTimer = 1.2f; // Cooldown 2 detik
+                }
+                break;
             }
 
-            mStateTimer -= dt;
-            if (mStateTimer <= 0) {
-                mState = ChargerState::IDLE;
+            case ChargerState::COOLDOWN: {
+                // 🔥 LOGIC PERLAMBATAN (DRIFTING)
+                // 0.5 detik pertama cooldown dipakai untuk pengereman
+                float totalCooldown = 2.0f;
+                float slideDuration = 0.5f; 
+                float timeInCooldown = totalCooldown - stateTimer;
+
+                if (timeInCooldown < slideDuration) {
+                    // Hitung faktor perlambatan (Dari 1.0 ke 0.0), EaseOut biar terasa berat
+                    float slowdownFactor = 1.0f - (timeInCooldown / slideDuration);
+                    slowdownFactor = slowdownFactor * slowdownFactor; 
+
+                    // Speed awal pengereman = 40% dari dash speed
+                    float currentSlideSpeed = dashSpeed * 0.4f * slowdownFactor;
+                    position = s.SweepMove(position, Vector3Scale(dashDirection, currentSlideSpeed * dt), s.radius[row]);
+                }
+
+                stateTimer -= dt;
+                if (stateTimer <= 0) {
+                    state = ChargerState::IDLE;
+                }
+                break;
             }
-            break;
         }
-    }
 
-    // Gravity
-    if (position.y > 0) position.y -= 10.0f * dt;
-    if (position.y < 0) position.y = 0;
-}
+        // Gravity
+        if (position.y > 0) position.y -= 10.0f * dt;
+        if (position.y < 0) position.y = 0;
 
-void ChargerEnemy::Draw(Model& slimeModel, Model& cubeModel, Model& magnetModel, 
-                        Model& shadowPlane, Camera3D cam, Vector3 playerPos) {
-    if (!active) return;
+        s.position[row] = position;
+        s.state[row] = (unsigned char)state;
+    }
+}
 
-    // Shadow
-    float shadowScale = radius * 2.2f;
-    DrawModelEx(shadowPlane, {position.x, 0.02f, position.z}, 
-                {0, 1, 0}, 0.0f, {shadowScale, 1.0f, shadowScale}, 
-                ColorAlpha(BLACK, 0.4f));
+void ChargerEnemy::Draw(EnemyStore& s, int row, Vector3 position, const EnemyDrawContext& ctx) {
+    ChargerState state = (ChargerState)s.state[row];
+    float stateTimer = s.stateTimer[row];
+    Vector3 dashDirection = s.moveDir[row];
+    float radius = s.radius[row];
+    float scaleSize = s.scaleSize[row];
+    Color bodyColor = s.bodyColor[row];
 
     // Rotation
-    Vector3 dir = (mState == ChargerState::DASHING || mState == ChargerState::COOLDOWN) 
-                  ? mDashDirection : Vector3Subtract(playerPos, position);
+    Vector3 dir = (state == ChargerState::DASHING || state == ChargerState::COOLDOWN) 
+                  ? dashDirection : Vector3Subtract(ctx.playerPos, position);
     float rotationY = atan2f(dir.x, dir.z) * RAD2DEG;
 
     // Body
@@ -142,34 +144,31 @@ void ChargerEnemy::Draw(Model& slimeModel, Model& cubeModel, Model& magnetModel,
     drawPos.y += scale.y * 0.5f;
 
     Color currentColor = bodyColor;
-    if (mState == ChargerState::CHARGING_UP) {
-        if ((int)(mStateTimer * 6) % 2 == 0) currentColor = RED;
+    if (state == ChargerState::CHARGING_UP) {
+        if ((int)(stateTimer * 6) % 2 == 0) currentColor = RED;
     }
     // 🔥 VISUAL COOLDOWN: Warna jadi agak gelap (kecapekan)
-    else if (mState == ChargerState::COOLDOWN) {
+    else if (state == ChargerState::COOLDOWN) {
         currentColor = ColorBrightness(bodyColor, -0.3f); 
     }
 
-    Color finalColor = GetRenderColor(currentColor);
+    Color finalColor = EnemyFlashColor(currentColor, s.flashTimer[row]);
 
-    cubeModel.materials[0].maps[MATERIAL_MAP_DIFFUSE].color = finalColor;
-    DrawModelEx(cubeModel, drawPos, {0, 1, 0}, rotationY, scale, WHITE);
-    cubeModel.materials[0].maps[MATERIAL_MAP_DIFFUSE].color = WHITE;
+    s.DrawCubeBody(ctx, EnemyBodyTransform(drawPos, rotationY, scale), finalColor);
 
     // 🔥 TRAIL LOGIC
-    if (mState == ChargerState::DASHING) {
+    if (state == ChargerState::DASHING) {
         // Trail Ungu (Energi)
         DrawSphere(position, radius * 0.5f, ColorAlpha(PURPLE, 0.3f));
     } 
-    else if (mState == ChargerState::COOLDOWN && mStateTimer > 1.5f) {
-        // 🔥 TRAIL ASAP PENGEREMAN (Gray/Smoke)
-        // Muncul hanya di 0.5 detik pertama cooldown
+    else if (state == ChargerState::COOLDOWN && stateTimer > 1.5f) {
+        // 🔥 TRAIL ASAP PENGEREMAN (Gray/Smoke), muncul di awal cooldown
         Vector3 dustPos = position;
         dustPos.y = 0.5f;
         // Asap di belakang bawah (ban ngerem)
-        dustPos = Vector3Subtract(dustPos, Vector3Scale(mDashDirection, 0.5f));
+        dustPos = Vector3Subtract(dustPos, Vector3Scale(dashDirection, 0.5f));
         
         DrawSphere(dustPos, radius * 0.4f, ColorAlpha(GRAY, 0.4f));
         DrawCubeWires(dustPos, radius * 0.5f, radius * 0.5f, radius * 0.5f, ColorAlpha(DARKGRAY, 0.5f));
     }
-}
\ No newline at end of file
+}
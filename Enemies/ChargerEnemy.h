@@ -1,27 +1,21 @@
 #pragma once
-#include "BaseEnemy.h"
 #include "raylib.h"
+#include <vector>
 
-enum class ChargerState {
+class EnemyStore;
+struct EnemyDrawContext;
+
+enum class ChargerState : unsigned char {
     IDLE,
     CHARGING_UP,  // Persiapan dash (telegraph)
     DASHING,      // Lagi dash cepet
     COOLDOWN      // Capek abis dash
 };
 
-class ChargerEnemy : public BaseEnemy {
-public:
-    ChargerEnemy(int tier, Vector3 startPos);
-    
-    void Update(float dt, Vector3 playerPos) override;
-    void Draw(Model& slimeModel, Model& cubeModel, Model& magnetModel, 
-              Model& shadowPlane, Camera3D cam, Vector3 playerPos) override;
-
-private:
-    ChargerState mState;
-    float mStateTimer;
-    Vector3 mDashDirection;
-    float mDashSpeed;
-    Color bodyColor;
-    float scaleSize;
-};
\ No newline at end of file
+// Charger: jalan -> telegraph -> dash -> ngerem.
+// Kolom yang dipake: state (ChargerState), stateTimer, moveDir (arah dash), attackPower (dash speed)
+namespace ChargerEnemy {
+    void Init(EnemyStore& store, int row);
+    void UpdateBatch(EnemyStore& store, const std::vector<int>& rows, Vector3 playerPos);
+    void Draw(EnemyStore& store, int row, Vector3 position, const EnemyDrawContext& ctx);
+}
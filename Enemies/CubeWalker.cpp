@@ -1,71 +1,78 @@
 #include "CubeWalker.h"
+#include "EnemyStore.h"
 #include "raymath.h"
 #include <cmath>
 #include "rlgl.h"
 
-CubeWalker::CubeWalker(int tierInput, Vector3 startPos) : BaseEnemy(tierInput, startPos) {
-    tier = tierInput;
-    position = startPos;
-    velocity = {0, 0, 0};
-    active = true;
-    canSplitStatus = false; // Default: Tidak membelah
+void CubeWalker::Init(EnemyStore& s, int row) {
+    int tier = s.tier[row];
+    s.canSplit[row] = 0; // Default: Tidak membelah
 
     // --- LOGIC RNG VARIAN (KHUSUS TIER 1) ---
     if (tier == 1) {
         int roll = GetRandomValue(0, 100);
 
         if (roll < 30) { // VARIAN: SPEEDY (Kecil & Gesit)
-            hp = 10;
-            speed = 7.5f;
-            radius = 0.8f;
-            scaleSize = 0.7f;
-            bodyColor = LIME;
-            xpReward = 5; 
+            s.hp[row] = 10;
+            s.speed[row] = 7.5f;
+            s.radius[row] = 0.8f;
+            s.scaleSize[row] = 0.7f;
+            s.bodyColor[row] = LIME;
+            s.xpReward[row] = 5; 
         } 
         else if (roll > 80) { // VARIAN: TANKER (Gede & Bisa Mbelah)
-            hp = 70;
-            speed = 3.0f;
-            radius = 1.6f;
-            scaleSize = 1.4f;
-            bodyColor = DARKGRAY;
-            xpReward = 45;
-            canSplitStatus = true; // AKTIFKAN SPLITTING
+            s.hp[row] = 70;
+            s.speed[row] = 3.0f;
+            s.radius[row] = 1.6f;
+            s.scaleSize[row] = 1.4f;
+            s.bodyColor[row] = DARKGRAY;
+            s.xpReward[row] = 45;
+            s.canSplit[row] = 1; // AKTIFKAN SPLITTING
         } 
         else { // VARIAN: NORMAL (Merah Lu yang Dulu)
-            hp = 20;
-            speed = 5.0f;
-            radius = 1.2f;
-            scaleSize = 1.0f;
-            bodyColor = RED;
-            xpReward = 15;
+            s.hp[row] = 20;
+            s.speed[row] = 5.0f;
+            s.radius[row] = 1.2f;
+            s.scaleSize[row] = 1.0f;
+            s.bodyColor[row] = RED;
+            s.xpReward[row] = 15;
         }
     } 
     else {
         // Stats untuk Tier 2 (Blue) atau Tier 3 (Gold)
-        // Bisa lu tambahin RNG lagi di sini kalau mau
-        hp = (tier == 2) ? 100 : 500;
-        speed = (tier == 2) ? 4.0f : 2.5f;
-        radius = (tier == 2) ? 2.0f : 4.0f;
-        scaleSize = radius;
-        bodyColor = (tier == 2) ? BLUE : GOLD;
-        xpReward = (tier == 2) ? 100 : 1000;
+        s.hp[row] = (tier == 2) ? 100 : 500;
+        s.speed[row] = (tier == 2) ? 4.0f : 2.5f;
+        s.radius[row] = (tier == 2) ? 2.0f : 4.0f;
+        s.scaleSize[row] = s.radius[row];
+        s.bodyColor[row] = (tier == 2) ? BLUE : GOLD;
+        s.xpReward[row] = (tier == 2) ? 100 : 1000;
     }
 }
 
-void CubeWalker::Update(float dt, Vector3 playerPos) {
+void CubeWalker::UpdateBatch(EnemyStore& s, const std::vector<int>& rows, Vector3 playerPos) {
+    // Loop paling panas (walker = mayoritas horde): arah udah disiapin store (chaseDir),
+    // tinggal maju. Gak ada virtual call / pointer chase / sqrt di sini
+    Vector3* position = s.position.data();
+    const Vector3* chaseDir = s.chaseDir.data();
+    const float* speed = s.speed.data();
+    const float* aiDt = s.aiDt.data();
+    const unsigned char* active = s.active.data();
 
-    UpdateFlash(dt);
+    for (int row : rows) {
+        if (!active[row]) continue;
 
-    Vector3 dir = Vector3Subtract(playerPos, position);
-    dir.y = 0;
-    dir = Vector3Normalize(dir);
-    position = Vector3Add(position, Vector3Scale(dir, speed * dt));
+        float step = speed[row] * aiDt[row];
+        position[row].x += chaseDir[row].x * step;
+        position[row].z += chaseDir[row].z * step;
+    }
 }
 
-void CubeWalker::Draw(Model& slimeModel, Model& cubeModel, Model& magnetModel, Model& shadowPlane, Camera3D cam, Vector3 playerPos) {
+void CubeWalker::Draw(EnemyStore& s, int row, Vector3 position, const EnemyDrawContext& ctx) {
+    float scaleSize = s.scaleSize[row];
+
     // 1. Hitung Rotasi & Animasi
-    float dx = playerPos.x - position.x;
-    float dz = playerPos.z - position.z;
+    float dx = ctx.playerPos.x - position.x;
+    float dz = ctx.playerPos.z - position.z;
     float rotationY = atan2f(dx, dz) * RAD2DEG;
     float wobble = sinf(GetTime() * 15.0f) * 8.0f;
 
@@ -74,25 +81,11 @@ void CubeWalker::Draw(Model& slimeModel, Model& cubeModel, Model& magnetModel, M
     Vector3 drawPos = position;
     drawPos.y += currentScale.y * 0.5f;
 
-    // 3. GAMBAR BAYANGAN
-    float shadowScale = radius * 1.2f;
-    rlDisableDepthMask();
-    DrawModelEx(shadowPlane, 
-                (Vector3){position.x, 0.02f, position.z}, 
-                (Vector3){0, 1, 0}, 0.0f, 
-                (Vector3){shadowScale, 1.0f, shadowScale}, 
-                ColorAlpha(BLACK, 0.4f));
-    rlEnableDepthMask();
+    // 3. Bayangan digambar bareng semua entity (EnemyStore::SubmitShadows)
 
     // 4. 🔥 FIX: HIT EFFECT (Warna Dinamis)
-    Color finalColor = GetRenderColor(bodyColor);
+    Color finalColor = EnemyFlashColor(s.bodyColor[row], s.flashTimer[row]);
 
-    // Terapkan warna ke material
-    cubeModel.materials[0].maps[MATERIAL_MAP_DIFFUSE].color = finalColor;
-    
-    // Draw Model
-    DrawModelEx(cubeModel, drawPos, (Vector3){0, 1, 0}, rotationY + wobble, currentScale, WHITE);
-    
-    // ⚠️ WAJIB RESET WARNA (Agar musuh lain tidak ikut kedip)
-    cubeModel.materials[0].maps[MATERIAL_MAP_DIFFUSE].color = WHITE;
-}
\ No newline at end of file
+    // Warna per-instance (gak ngubah material, jadi semua walker bisa 1 batch)
+    s.DrawCubeBody(ctx, EnemyBodyTransform(drawPos, rotationY + wobble, currentScale), finalColor);
+}
@@ -1,19 +1,17 @@
 // CubeWalker.h
 #pragma once
-#include "BaseEnemy.h"
+#include "raylib.h"
+#include <vector>
 
-class CubeWalker : public BaseEnemy {
-public:
-    CubeWalker(int tier, Vector3 startPos);
-    void Update(float dt, Vector3 playerPos) override;
-    
-    // Parameter draw tetep sama, tapi dalemnya nanti kita pake warna beda
-    void Draw(Model& slimeModel, Model& cubeModel, Model& magnetModel, Model& shadowPlane, Camera3D cam, Vector3 playerPos) override;
+class EnemyStore;
+struct EnemyDrawContext;
 
-    bool CanSplit() const override { return canSplitStatus; }
+// Musuh dasar: jalan lurus ngejar player.
+// Data ada di EnemyStore (SoA), di sini cuma behavior batch-nya.
+namespace CubeWalker {
+    void Init(EnemyStore& store, int row); // RNG varian (Speedy / Tanker / Normal)
+    void UpdateBatch(EnemyStore& store, const std::vector<int>& rows, Vector3 playerPos);
 
-private:
-    Color bodyColor;  // Warna badan (Merah, Hijau, Hitam?)
-    float scaleSize;  // Ukuran badan (Kecil/Gede)
-    bool canSplitStatus;
-};
\ No newline at end of file
+    // Parameter draw tetep sama, tapi dalemnya pake warna beda per varian
+    void Draw(EnemyStore& store, int row, Vector3 position, const EnemyDrawContext& ctx);
+}
@@ -0,0 +1,639 @@
+#include "EnemyStore.h"
+#include "CubeWalker.h"
+#include "SlimeJumper.h"
+#include "ShooterEnemy.h"
+#include "ChargerEnemy.h"
+#include "ExploderEnemy.h"
+#include "BossEnemy.h"
+#include "Rat.h"
+#include "../Systems/SpatialHashGrid.h"
+#include "../Systems/FlowField.h"
+#include "../Systems/EnemyProjectilePool.h"
+#include "../Managers/LevelManager.h"
+#include "raymath.h"
+#include "rlgl.h"
+#include <cmath>
+
+// Tabel capability per tipe musuh
+static unsigned int CapabilitiesFor(EnemyType type) {
+    switch (type) {
+        case EnemyType::SHOOTER:      return ENEMY_CAP_SHOOTS;
+        case EnemyType::BOSS:         return ENEMY_CAP_SHOOTS | ENEMY_CAP_SPAWNS_MINIONS;
+        case EnemyType::EXPLODER:     return ENEMY_CAP_EXPLODES;
+        case EnemyType::SLIME_JUMPER: return ENEMY_CAP_DROPS_LOOT;
+        default:                      return ENEMY_CAP_NONE;
+    }
+}
+
+static const int BOSS_RESERVE = 8; // Boss hidup barengan (1 per wave boss, paling 2-3 kalau telat dibunuh)
+
+EnemyStore::EnemyStore()
+    : mCount(0), mFlowField(nullptr), mProjectiles(nullptr), mLevel(nullptr), mAiTick(0), mHasViewCone(false),
+      mViewEye({0, 0, 0}), mViewForward({0, 0, 1}), mViewCosHalfAngle(-1.0f) {}
+
+void EnemyStore::Reserve(int rows) {
+    type.reserve(rows);
+    capabilities.reserve(rows);
+    active.reserve(rows);
+    position.reserve(rows);
+    prevPosition.reserve(rows);
+    velocity.reserve(rows);
+    radius.reserve(rows);
+    hp.reserve(rows);
+    flashTimer.reserve(rows);
+    speed.reserve(rows);
+    chaseDir.reserve(rows);
+    aiDt.reserve(rows);
+    aiAccum.reserve(rows);
+    aiInterval.reserve(rows);
+
+    tier.reserve(rows);
+    maxHp.reserve(rows);
+    xpReward.reserve(rows);
+    scaleSize.reserve(rows);
+    bodyColor.reserve(rows);
+    canSplit.reserve(rows);
+
+    state.reserve(rows);
+    stateTimer.reserve(rows);
+    moveDir.reserve(rows);
+    attackRange.reserve(rows);
+    attackPower.reserve(rows);
+    attackCooldown.reserve(rows);
+    animTimer.reserve(rows);
+    variant.reserve(rows);
+    lootType.reserve(rows);
+    lootTier.reserve(rows);
+
+    for (auto& list : mRowsByType) list.reserve(rows);
+    for (auto& list : mScheduled) list.reserve(rows);
+    bosses.reserve(BOSS_RESERVE);
+    mRemap.reserve(rows);
+    mSeparationPush.reserve(rows);
+    mNeighbors.reserve(256);
+}
+
+// ============================================================================
+// SPAWN
+// ============================================================================
+
+int EnemyStore::AddRow(EnemyType t, int tierInput, Vector3 pos) {
+    int row = (int)type.size();
+    if (type.size() == type.capacity()) mAllocStats.columnGrowths++;
+
+    // Default sama kayak constructor BaseEnemy lama
+    type.push_back(t);
+    capabilities.push_back(CapabilitiesFor(t));
+    active.push_back(1);
+    position.push_back(pos);
+    prevPosition.push_back(pos);
+    velocity.push_back({0, 0, 0});
+    radius.push_back(1.0f);
+    hp.push_back(10.0f);
+    flashTimer.push_back(0.0f);
+    speed.push_back(1.0f);
+    chaseDir.push_back({0, 0, 0});
+    aiDt.push_back(0.0f);
+    aiAccum.push_back(0.0f);
+    aiInterval.push_back(1);
+
+    tier.push_back(tierInput);
+    maxHp.push_back(10.0f);
+    xpReward.push_back(10);
+    scaleSize.push_back(1.0f);
+    bodyColor.push_back(WHITE);
+    canSplit.push_back(0);
+
+    state.push_back(0);
+    stateTimer.push_back(0.0f);
+    moveDir.push_back({0, 0, 0});
+    attackRange.push_back(0.0f);
+    attackPower.push_back(0.0f);
+    attackCooldown.push_back(0.0f);
+    animTimer.push_back(0.0f);
+    variant.push_back(0);
+    lootType.push_back(ItemType::NONE);
+    lootTier.push_back(0);
+
+    return row;
+}
+
+int EnemyStore::Spawn(EnemyType t, int tierInput, Vector3 pos) {
+    int row = AddRow(t, tierInput, pos);
+
+    switch (t) {
+        case EnemyType::CUBE_WALKER:  CubeWalker::Init(*this, row); break;
+        case EnemyType::SLIME_JUMPER: SlimeJumper::Init(*this, row); break;
+        case EnemyType::SHOOTER:      ShooterEnemy::Init(*this, row); break;
+        case EnemyType::CHARGER:      ChargerEnemy::Init(*this, row); break;
+        case EnemyType::EXPLODER:     ExploderEnemy::Init(*this, row); break;
+        case EnemyType::RAT:          Rat::Init(*this, row); break;
+        default: break; // BOSS lewat SpawnBoss
+    }
+    return row;
+}
+
+int EnemyStore::SpawnBoss(BossType bossType, Vector3 pos, int waveNumber) {
+    int row = AddRow(EnemyType::BOSS, 4, pos);
+    if (bosses.size() == bosses.capacity()) mAllocStats.listGrowths++; // Init push_back ke side table
+    BossEnemy::Init(*this, row, bossType, waveNumber);
+    return row;
+}
+
+void EnemyStore::CommitPending() {
+    if (mCount == TotalRows()) return;
+    mCount = TotalRows();
+    RebuildTypeLists();
+}
+
+void EnemyStore::Clear() {
+    ResizeColumns(0);
+    bosses.clear();
+    mCount = 0;
+    RebuildTypeLists();
+}
+
+// ============================================================================
+// COMPACTION (stable: urutan row tetap, biar hasil "kena duluan" konsisten)
+// ============================================================================
+
+void EnemyStore::MoveRow(int from, int to) {
+    type[to] = type[from];
+    capabilities[to] = capabilities[from];
+    active[to] = active[from];
+    position[to] = position[from];
+    prevPosition[to] = prevPosition[from];
+    velocity[to] = velocity[from];
+    radius[to] = radius[from];
+    hp[to] = hp[from];
+    flashTimer[to] = flashTimer[from];
+    speed[to] = speed[from];
+    chaseDir[to] = chaseDir[from];
+    aiDt[to] = aiDt[from];
+    aiAccum[to] = aiAccum[from];
+    aiInterval[to] = aiInterval[from];
+
+    tier[to] = tier[from];
+    maxHp[to] = maxHp[from];
+    xpReward[to] = xpReward[from];
+    scaleSize[to] = scaleSize[from];
+    bodyColor[to] = bodyColor[from];
+    canSplit[to] = canSplit[from];
+
+    state[to] = state[from];
+    stateTimer[to] = stateTimer[from];
+    moveDir[to] = moveDir[from];
+    attackRange[to] = attackRange[from];
+    attackPower[to] = attackPower[from];
+    attackCooldown[to] = attackCooldown[from];
+    animTimer[to] = animTimer[from];
+    variant[to] = variant[from];
+    lootType[to] = lootType[from];
+    lootTier[to] = lootTier[from];
+}
+
+void EnemyStore::ResizeColumns(int rows) {
+    type.resize(rows);
+    capabilities.resize(rows);
+    active.resize(rows);
+    position.resize(rows);
+    prevPosition.resize(rows);
+    velocity.resize(rows);
+    radius.resize(rows);
+    hp.resize(rows);
+    flashTimer.resize(rows);
+    speed.resize(rows);
+    chaseDir.resize(rows);
+    aiDt.resize(rows);
+    aiAccum.resize(rows);
+    aiInterval.resize(rows);
+
+    tier.resize(rows);
+    maxHp.resize(rows);
+    xpReward.resize(rows);
+    scaleSize.resize(rows);
+    bodyColor.resize(rows);
+    canSplit.resize(rows);
+
+    state.resize(rows);
+    stateTimer.resize(rows);
+    moveDir.resize(rows);
+    attackRange.resize(rows);
+    attackPower.resize(rows);
+    attackCooldown.resize(rows);
+    animTimer.resize(rows);
+    variant.resize(rows);
+    lootType.resize(rows);
+    lootTier.resize(rows);
+}
+
+void EnemyStore::Compact() {
+    int total = TotalRows();
+    if ((int)mRemap.capacity() < total) mAllocStats.listGrowths++;
+    mRemap.assign(total, -1);
+
+    // Row aktif yang mati dibuang, row pending selalu ikut (baru spawn)
+    int write = 0;
+    for (int r = 0; r < total; r++) {
+        if (r < mCount && !active[r]) continue;
+        if (r != write) MoveRow(r, write);
+        mRemap[r] = write;
+        write++;
+    }
+    ResizeColumns(write);
+    mCount = write;
+
+    // Side table boss ikut: buang yang row-nya hilang, update index row
+    int bossWrite = 0;
+    for (int b = 0; b < (int)bosses.size(); b++) {
+        int newRow = mRemap[bosses[b].row];
+        if (newRow < 0) continue;
+        bosses[bossWrite] = bosses[b];
+        bosses[bossWrite].row = newRow;
+        bossWrite++;
+    }
+    bosses.resize(bossWrite);
+
+    RebuildTypeLists();
+}
+
+void EnemyStore::RebuildTypeLists() {
+    for (auto& list : mRowsByType) list.clear();
+    for (int r = 0; r < mCount; r++) {
+        std::vector<int>& list = mRowsByType[(int)type[r]];
+        if (list.size() == list.capacity()) mAllocStats.listGrowths++;
+        list.push_back(r);
+    }
+}
+
+// ============================================================================
+// SIMULATION
+// ============================================================================
+
+void EnemyStore::SavePreviousState() {
+    for (int r = 0; r < mCount; r++) prevPosition[r] = position[r];
+}
+
+void EnemyStore::SetViewCone(Vector3 eye, Vector3 forward, float cosHalfAngle) {
+    mHasViewCone = true;
+    mViewEye = eye;
+    mViewForward = Vector3Normalize(forward);
+    mViewCosHalfAngle = cosHalfAngle;
+}
+
+static int RoundUpPow2(int v) {
+    int p = 1;
+    while (p < v && p < 128) p <<= 1;
+    return p;
+}
+
+void EnemyStore::SetAiLod(const AiLodConfig& config) {
+    mAiLod = config;
+    mAiLod.midInterval = RoundUpPow2(config.midInterval);
+    mAiLod.farInterval = RoundUpPow2(config.farInterval);
+}
+
+void EnemyStore::ScheduleAi(float dt, Vector3 playerPos) {
+    for (auto& list : mScheduled) list.clear();
+    mAiStats = AiLodStats();
+    mAiTick++;
+
+    float nearSq = mAiLod.nearDistance * mAiLod.nearDistance;
+    float farSq = mAiLod.farDistance * mAiLod.farDistance;
+    int budget = (mAiLod.updateBudget > 0) ? mAiLod.updateBudget : mCount;
+
+    for (int r = 0; r < mCount; r++) {
+        if (!active[r]) continue;
+        aiAccum[r] += dt;
+        aiDt[r] = 0.0f;
+
+        unsigned int phase = mAiTick + (unsigned int)r;
+
+        // 1. Klasifikasi jarak / kamera cuma tiap 8 tick per row (digeser per row),
+        //    biar scheduler-nya sendiri gak lebih mahal dari behavior yang dihemat
+        if ((phase & 7u) == 0) {
+            int level = 0;
+            if (mAiLod.enabled && type[r] != EnemyType::BOSS) {
+                float dx = position[r].x - playerPos.x;
+                float dz = position[r].z - playerPos.z;
+                float distSq = dx * dx + dz * dz;
+                level = (distSq < nearSq) ? 0 : ((distSq < farSq) ? 1 : 2);
+
+                // Di luar kerucut kamera = turun 1 level
+                if (mHasViewCone && level < 2) {
+                    Vector3 toEnemy = Vector3Subtract(position[r], mViewEye);
+                    float len = Vector3Length(toEnemy);
+                    if (len > 0.0f && Vector3DotProduct(toEnemy, mViewForward) < mViewCosHalfAngle * len) level++;
+                }
+            }
+            aiInterval[r] = (unsigned char)((level == 0) ? 1 : ((level == 1) ? mAiLod.midInterval : mAiLod.farInterval));
+        }
+
+        // 2. Peluru udah di EnemyProjectilePool (selalu full rate), jadi shooter ikut LOD biasa
+        unsigned int interval = aiInterval[r];
+
+        // Charger di luar IDLE gerak pakai attackPower (100-180 u/s), bukan speed: jangan ditabung.
+        // Telegraph-nya juga harus pas di layar, jadi full rate sampai balik IDLE
+        if (type[r] == EnemyType::CHARGER && state[r] != (unsigned char)ChargerState::IDLE) interval = 1;
+
+        if (interval > 1) {
+            // Jadwal digeser per row biar yang jauh gak update barengan di tick yang sama
+            bool due = (phase & (interval - 1)) == 0;
+            bool starving = aiAccum[r] >= mAiLod.maxStep;
+            if (!starving && (!due || budget <= 0)) {
+                mAiStats.deferred++;
+                continue;
+            }
+            budget--;
+            mAiStats.reduced++;
+        } else {
+            mAiStats.fullRate++;
+        }
+
+        // 3. Kebagian jadwal: pakai dt tabungan, tapi maks maxStepDistance per langkah.
+        //    Sisanya kebawa; kalau numpuk sampai maxStep, row dipaksa update tiap tick sampai lunas
+        //    (jadi musuh jauh yang cepet otomatis kebagian jadwal lebih sering, bukan lompat jauh)
+        float stepDt = aiAccum[r];
+        float cellDt = mAiLod.maxStepDistance / fmaxf(speed[r], 0.001f);
+        if (stepDt > cellDt) stepDt = cellDt;
+        aiDt[r] = stepDt;
+        aiAccum[r] -= stepDt;
+        mScheduled[(int)type[r]].push_back(r);
+    }
+}
+
+void EnemyStore::UpdateChaseDirections(Vector3 playerPos) {
+    // Sekali per tick buat row yang kebagian jadwal: tipe-tipe tinggal baca chaseDir
+    for (int r = 0; r < mCount; r++) {
+        if (aiDt[r] <= 0.0f) continue;
+        if (mFlowField && mFlowField->SampleDirection(position[r], chaseDir[r])) continue;
+
+        // Nyangkut di cell tembok (FLOW_NO_DIR): keluar dulu ke cell kosong terdekat,
+        // jangan kejar lurus nembus tembok
+        if (mFlowField && mFlowField->SampleEscape(position[r], chaseDir[r])) continue;
+
+        // Fallback kejar lurus (gak ada map / di luar map / udah nempel player)
+        float dx = playerPos.x - position[r].x;
+        float dz = playerPos.z - position[r].z;
+        float lenSq = dx * dx + dz * dz;
+        float invLen = (lenSq > 0.0f) ? 1.0f / sqrtf(lenSq) : 0.0f;
+        chaseDir[r] = {dx * invLen, 0.0f, dz * invLen};
+    }
+}
+
+void EnemyStore::UpdateBehaviors(float dt, Vector3 playerPos) {
+    // Flash timer semua row sekaligus (dulu UpdateFlash di tiap Update anak)
+    // (branchless biar compiler bisa vectorize; row mati gak masalah ikut turun)
+    float* flash = flashTimer.data();
+    for (int r = 0; r < mCount; r++) {
+        flash[r] = (flash[r] > 0) ? flash[r] - dt : flash[r];
+    }
+
+    // AI LOD: siapa yang mikir tick ini & pakai dt berapa (store.aiDt)
+    ScheduleAi(dt, playerPos);
+    UpdateChaseDirections(playerPos);
+
+    CubeWalker::UpdateBatch(*this, mScheduled[(int)EnemyType::CUBE_WALKER], playerPos);
+    ChargerEnemy::UpdateBatch(*this, mScheduled[(int)EnemyType::CHARGER], playerPos);
+    SlimeJumper::UpdateBatch(*this, mScheduled[(int)EnemyType::SLIME_JUMPER], playerPos);
+    ExploderEnemy::UpdateBatch(*this, mScheduled[(int)EnemyType::EXPLODER], playerPos);
+    ShooterEnemy::UpdateBatch(*this, mScheduled[(int)EnemyType::SHOOTER], playerPos);
+    Rat::UpdateBatch(*this, mScheduled[(int)EnemyType::RAT], playerPos);
+    BossEnemy::UpdateAll(*this, dt, playerPos); // Boss selalu full rate
+
+    ResolveWallContacts();
+}
+
+void EnemyStore::ResolveWallContacts() {
+    // Flow field cuma milih arah; gerak beneran (separation sebelumnya, langkah diagonal, langkah LOD)
+    // tetap bisa nyerempet tembok. Row yang gerak tick ini didorong keluar lewat SDF (O(1) per row)
+    if (!mLevel) return;
+    for (int r = 0; r < mCount; r++) {
+        if (!active[r] || aiDt[r] <= 0.0f) continue;
+        position[r] = ClampToWalls(prevPosition[r], position[r], radius[r]);
+    }
+}
+
+Vector3 EnemyStore::SweepMove(Vector3 from, Vector3 delta, float r) const {
+    Vector3 to = Vector3Add(from, delta);
+    if (!mLevel) return to;
+
+    // 1 dash = 2-3 unit per tick: sekali ClampToWalls bisa lompatin tembok tipis.
+    // Potong per maxStepDistance, tiap potong nempel / geser di tembok kayak jalan biasa
+    float dist = sqrtf(delta.x * delta.x + delta.z * delta.z);
+    int steps = (int)ceilf(dist / fmaxf(mAiLod.maxStepDistance, 0.05f));
+    if (steps <= 1) return ClampToWalls(from, to, r);
+
+    Vector3 step = Vector3Scale(delta, 1.0f / (float)steps);
+    Vector3 pos = from;
+    for (int i = 0; i < steps; i++) pos = ClampToWalls(pos, Vector3Add(pos, step), r);
+    return pos;
+}
+
+Vector3 EnemyStore::ClampToWalls(Vector3 from, Vector3 to, float r) const {
+    if (!mLevel) return to;
+    Vector3 out = mLevel->ResolveCircle(to, r);
+
+    // Langkah kegedean sampai titik tengah tembus tembok tebel / keluar map (SDF gak punya arah
+    // buat dorong balik): batalin gerak XZ-nya, asal posisi awal emang masih di tempat kosong
+    if (mLevel->GetWallDistance(out) < 0.0f && mLevel->GetWallDistance(from) >= 0.0f) {
+        out.x = from.x;
+        out.z = from.z;
+    }
+    return out;
+}
+
+// ============================================================================
+// CROWD SEPARATION
+// ============================================================================
+
+static const float SEPARATION_STIFFNESS = 30.0f; // Bagian overlap yang diberesin per detik
+
+void EnemyStore::ApplySeparation(SpatialHashGrid& grid, float dt) {
+    if (mCount < 2) return;
+
+    // 1. Grid titik: tiap musuh cuma masuk 1 cell, tetangga dicari lewat radius query
+    //    (jangkauan query = radius sendiri + radius terbesar yang ada di tick ini)
+    float maxRadius = 0.0f;
+    grid.Clear();
+    for (int r = 0; r < mCount; r++) {
+        if (!active[r]) continue;
+        grid.Insert(r, position[r], 0.0f);
+        maxRadius = fmaxf(maxRadius, radius[r]);
+    }
+    grid.Build();
+
+    // 2. Hitung dorongan dari posisi lama semua (hasil gak tergantung urutan row)
+    if ((int)mSeparationPush.capacity() < mCount) mAllocStats.listGrowths++;
+    mSeparationPush.assign(mCount, {0, 0, 0});
+    float blend = fminf(1.0f, SEPARATION_STIFFNESS * dt);
+
+    for (int i = 0; i < mCount; i++) {
+        if (!active[i]) continue;
+
+        Vector3 pi = position[i];
+        float ri = radius[i];
+        float wi = ri * ri;
+        float pushX = 0.0f, pushZ = 0.0f;
+
+        grid.QueryPoints(pi, ri + maxRadius, mNeighbors);
+        for (int j : mNeighbors) {
+            if (j == i) continue;
+
+            float dx = pi.x - position[j].x;
+            float dz = pi.z - position[j].z;
+            float minDist = ri + radius[j];
+            float distSq = dx * dx + dz * dz;
+            if (distSq >= minDist * minDist) continue;
+
+            // Yang gede lebih susah didorong (bobot = luas)
+            float wj = radius[j] * radius[j];
+            float share = wj / (wi + wj);
+
+            float dist = sqrtf(distSq);
+            float overlap = minDist - dist;
+            if (dist < 0.001f) {
+                // Numpuk persis: arah dari index (golden angle) biar tetap deterministik
+                float angle = (float)i * 2.39996f;
+                dx = cosf(angle);
+                dz = sinf(angle);
+                dist = 1.0f;
+            }
+
+            pushX += (dx / dist) * overlap * share;
+            pushZ += (dz / dist) * overlap * share;
+        }
+
+        mSeparationPush[i] = {pushX * blend, 0.0f, pushZ * blend};
+    }
+
+    // 3. Apply sekaligus. Crowd di mulut lorong jangan sampai kedorong masuk tembok:
+    //    dorongan di-sweep per cell (crowd padet bisa ngedorong beberapa unit sekaligus,
+    //    sekali clamp di ujungnya doang bisa tembus tembok tipis)
+    for (int i = 0; i < mCount; i++) {
+        if (mSeparationPush[i].x == 0.0f && mSeparationPush[i].z == 0.0f) continue;
+        position[i] = SweepMove(position[i], mSeparationPush[i], radius[i]);
+    }
+}
+
+void EnemyStore::TakeDamage(int row, float amount) {
+    hp[row] -= amount;
+
+    // 🔥 TRIGGER KEDIP (100ms tiap kena damage)
+    flashTimer[row] = 0.1f;
+
+    if (hp[row] <= 0) {
+        active[row] = 0;
+    }
+}
+
+void EnemyStore::FireBullet(const EnemyBullet& bullet) {
+    if (mProjectiles) mProjectiles->Spawn(bullet); // Pool penuh = peluru dibuang (dihitung di pool)
+}
+
+// ============================================================================
+// RENDER
+// ============================================================================
+
+// Blob shadow per tipe: sisi quad = radius * scale
+struct EnemyShadowStyle {
+    float scale;
+    float height;
+    Color tint;
+};
+
+static const EnemyShadowStyle ENEMY_SHADOW_STYLE[(int)EnemyType::COUNT] = {
+    { 1.2f, 0.02f, { 0, 0, 0, 102 } }, // CUBE_WALKER
+    { 2.5f, 0.02f, { 0, 0, 0, 120 } }, // SLIME_JUMPER (mengecil pas lompat)
+    { 2.2f, 0.02f, { 0, 0, 0, 102 } }, // SHOOTER
+    { 2.2f, 0.02f, { 0, 0, 0, 102 } }, // CHARGER
+    { 2.2f, 0.02f, { 0, 0, 0, 102 } }, // EXPLODER
+    { 3.0f, 0.05f, { 0, 0, 0, 153 } }, // BOSS
+    { 2.2f, 0.02f, { 0, 0, 0, 102 } }, // RAT
+};
+
+void EnemyStore::SubmitShadows(float alpha, ShadowBatch& shadows) {
+    for (int r = 0; r < mCount; r++) {
+        if (!active[r]) continue;
+
+        const EnemyShadowStyle& style = ENEMY_SHADOW_STYLE[(int)type[r]];
+        Vector3 renderPos = Vector3Lerp(prevPosition[r], position[r], alpha);
+        float size = radius[r] * style.scale;
+        if (type[r] == EnemyType::SLIME_JUMPER) size /= (1.0f + renderPos.y * 0.5f);
+
+        shadows.Add({ renderPos.x, style.height, renderPos.z }, size, style.tint);
+    }
+}
+
+void EnemyStore::Draw(float alpha, const EnemyDrawContext& ctx) {
+    mDrawStats = EnemyDrawStats();
+
+    for (int r = 0; r < mCount; r++) {
+        if (!active[r]) continue;
+
+        // Posisi render = interpolasi antara tick lama & baru
+        Vector3 renderPos = Vector3Lerp(prevPosition[r], position[r], alpha);
+
+        switch (type[r]) {
+            case EnemyType::CUBE_WALKER:  CubeWalker::Draw(*this, r, renderPos, ctx); break;
+            case EnemyType::SLIME_JUMPER: SlimeJumper::Draw(*this, r, renderPos, ctx); break;
+            case EnemyType::SHOOTER:      ShooterEnemy::Draw(*this, r, renderPos, ctx); break;
+            case EnemyType::CHARGER:      ChargerEnemy::Draw(*this, r, renderPos, ctx); break;
+            case EnemyType::EXPLODER:     ExploderEnemy::Draw(*this, r, renderPos, ctx); break;
+            case EnemyType::BOSS:         BossEnemy::Draw(*this, r, renderPos, ctx); break;
+            case EnemyType::RAT:          Rat::Draw(*this, r, renderPos, ctx); break;
+            default: break;
+        }
+    }
+
+    if (!ctx.batches) return;
+
+    // --- FLUSH INSTANCING ---
+    // Solid dulu (kubus), baru kulit slime transparan biar isi slime kelihatan dari luar
+    EnemyInstanceBatches& batches = *ctx.batches;
+    mDrawStats.instances = batches.cubes.Count() + batches.slimeShells.Count();
+    mDrawStats.drawCalls += batches.cubes.Flush(ctx.cubeModel->meshes[0], batches.cubeMaterial);
+
+    if (batches.slimeShells.Count() > 0) {
+        BeginBlendMode(BLEND_ALPHA);
+        rlDisableDepthMask();
+        mDrawStats.drawCalls += batches.slimeShells.Flush(ctx.slimeModel->meshes[0], batches.slimeMaterial);
+        rlEnableDepthMask();
+        EndBlendMode();
+    }
+}
+
+void EnemyStore::DrawCubeBody(const EnemyDrawContext& ctx, const Matrix& transform, Color color) {
+    if (ctx.batches) {
+        ctx.batches->cubes.Add(transform, color);
+        return;
+    }
+
+    // Jalur lama: warna lewat material, 1 draw call per body
+    Model& cubeModel = *ctx.cubeModel;
+    cubeModel.materials[0].maps[MATERIAL_MAP_DIFFUSE].color = color;
+    DrawMesh(cubeModel.meshes[0], cubeModel.materials[0], transform);
+    cubeModel.materials[0].maps[MATERIAL_MAP_DIFFUSE].color = WHITE; // ⚠️ Reset biar musuh lain gak ikut kedip
+    mDrawStats.drawCalls++;
+}
+
+Color EnemyFlashColor(Color originalColor, float flashTimer) {
+    // 🔥 Jika kena hit: campur 80% Putih + 20% Warna Asli (flash terang tapi tidak "buta")
+    if (flashTimer > 0) {
+        float mixFactor = 0.8f;
+
+        unsigned char r = (unsigned char)(255 * mixFactor + originalColor.r * (1.0f - mixFactor));
+        unsigned char g = (unsigned char)(255 * mixFactor + originalColor.g * (1.0f - mixFactor));
+        unsigned char b = (unsigned char)(255 * mixFactor + originalColor.b * (1.0f - mixFactor));
+
+        return (Color){r, g, b, 255};
+    }
+    return originalColor;
+}
+
+Matrix EnemyBodyTransform(Vector3 position, float rotationYDeg, Vector3 scale) {
+    Matrix matScale = MatrixScale(scale.x, scale.y, scale.z);
+    Matrix matRotation = MatrixRotateY(rotationYDeg * DEG2RAD);
+    Matrix matTranslation = MatrixTranslate(position.x, position.y, position.z);
+    return MatrixMultiply(MatrixMultiply(matScale, matRotation), matTranslation);
+}
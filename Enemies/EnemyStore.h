@@ -0,0 +1,230 @@
+#pragma once
+#include "raylib.h"
+#include "../Systems/ItemManager.h" // ItemType (loot slime)
+#include "BossEnemy.h"              // BossState (side table)
+#include "../Systems/InstanceBatch.h"
+#include "../Systems/ShadowBatch.h"
+#include <vector>
+
+class SpatialHashGrid;
+class FlowField;
+class LevelManager;
+class EnemyProjectilePool;
+struct EnemyBullet;
+
+// 🏷️ TYPE TAG (ganti dynamic_cast di loop per-frame)
+enum class EnemyType : unsigned char {
+    CUBE_WALKER,
+    SLIME_JUMPER,
+    SHOOTER,
+    CHARGER,
+    EXPLODER,
+    BOSS,
+    RAT,
+    COUNT
+};
+
+// Capability flags: Game cuma ngecek bit, gak perlu tau tipe aslinya
+enum EnemyCapability : unsigned int {
+    ENEMY_CAP_NONE           = 0,
+    ENEMY_CAP_SHOOTS         = 1 << 0, // Nembak ke EnemyProjectilePool (Shooter, Boss)
+    ENEMY_CAP_SPAWNS_MINIONS = 1 << 1, // Boss
+    ENEMY_CAP_EXPLODES       = 1 << 2, // Exploder
+    ENEMY_CAP_DROPS_LOOT     = 1 << 3  // SlimeJumper
+};
+
+
+// 🧊 Batch instancing musuh: semua body yang mesh-nya sama = 1 DrawMeshInstanced
+struct EnemyInstanceBatches {
+    InstanceBatch cubes;       // Body kubus (Walker, Charger, Shooter, Rat, Boss, isi slime BASIC)
+    InstanceBatch slimeShells; // Kulit slime (transparan, di-flush paling akhir)
+    Material cubeMaterial;     // Material cube/slime tapi shader-nya versi instanced
+    Material slimeMaterial;
+};
+
+// Model yang dibutuhin buat gambar musuh (dipass sekali per frame)
+struct EnemyDrawContext {
+    Model* slimeModel;
+    Model* cubeModel;
+    Model* magnetModel;
+    Camera3D cam;
+    Vector3 playerPos;
+    EnemyInstanceBatches* batches; // nullptr = jalur lama (1 DrawMesh per body)
+};
+
+// Hitungan draw call mesh musuh frame terakhir (overlay F3)
+struct EnemyDrawStats {
+    int drawCalls = 0; // DrawMesh / DrawModelEx / DrawMeshInstanced (shadow di ShadowBatch, gak dihitung)
+    int instances = 0; // Body yang masuk batch instancing
+};
+
+// 📦 Hitungan alokasi heap di store (buat buktiin wave steady-state = 0 alokasi)
+struct EnemyAllocStats {
+    int columnGrowths = 0; // Kolom row realloc (jumlah row lewat kapasitas Reserve)
+    int listGrowths = 0;   // List row per tipe / scratch Compact / side table boss realloc
+
+    int Total() const { return columnGrowths + listGrowths; }
+};
+
+// 🧠 AI LOD: musuh jauh / di luar layar mikir lebih jarang (dt-nya ditabung), yang deket tiap tick
+struct AiLodConfig {
+    bool enabled = true;
+    float nearDistance = 25.0f; // < ini: update tiap tick
+    float farDistance = 45.0f;  // >= ini: update tiap farInterval tick (di antaranya: midInterval)
+    int midInterval = 2;        // Interval dibulatin ke pangkat 2 (jadwal pakai mask, bukan modulo)
+    int farInterval = 4;
+    int updateBudget = 0;       // Maks update musuh NON-deket per tick (0 = gak dibatasi)
+    float maxStep = 0.25f;      // Tabungan dt lewat ini = dipaksa update walau budget habis
+    // Maks jarak 1 langkah AI (= 1 cell FlowField default). Arah cuma di-sample sekali per langkah,
+    // jadi langkah lebih jauh bisa motong pojok / lompatin tembok. Sisa dt tetap ditabung.
+    // Dihitung dari speed jalan; charger yang lagi charge / dash / ngerem selalu full rate
+    // dan dash-nya dipecah sendiri lewat SweepMove
+    float maxStepDistance = 1.0f;
+};
+
+// Hasil scheduler tick terakhir
+struct AiLodStats {
+    int fullRate = 0; // Deket (atau boss): update tiap tick
+    int reduced = 0;  // Jauh / luar layar yang kebagian jadwal tick ini
+    int deferred = 0; // Jauh / luar layar yang skip (dt ditabung)
+};
+
+// 🧱 ENEMY STORE (Struct of Arrays)
+// Semua musuh = 1 baris (row) di tabel. Tiap field punya array sendiri,
+// jadi loop yang cuma butuh posisi/radius gak ikut narik data lain ke cache.
+// Behavior per tipe jalan batch di atas row tipe itu (lihat CubeWalker.cpp dst).
+//
+// Row [0, Count())          = aktif di tick ini (di-loop Game)
+// Row [Count(), TotalRows()) = pending (spawn dari split/minion), masuk di Compact()
+//
+// Gak ada new/delete per musuh: row mati cuma ditimpa row berikutnya, kapasitas kolom
+// gak pernah dikembalikan. Peluru gak disimpen di sini (lihat EnemyProjectilePool).
+class EnemyStore {
+public:
+    EnemyStore();
+
+    // Alokasi di depan: kolom, list per tipe, & scratch
+    void Reserve(int rows);
+
+    // --- SPAWN ---
+    // Row baru selalu masuk pending. Init per tipe dipanggil langsung (urutan RNG sama kayak constructor lama)
+    int Spawn(EnemyType type, int tier, Vector3 pos);
+    int SpawnBoss(BossType bossType, Vector3 pos, int waveNumber);
+    void CommitPending();  // Pending -> aktif (dipanggil abis wave spawn)
+    void Compact();        // Buang row mati (urutan tetap) + commit pending
+    void Clear();
+
+    // --- SIMULATION ---
+    void SavePreviousState();
+    void SetFlowField(const FlowField* field) { mFlowField = field; } // nullptr = kejar lurus
+    void SetProjectilePool(EnemyProjectilePool* pool) { mProjectiles = pool; } // nullptr = peluru dibuang
+    void SetLevel(const LevelManager* level) { mLevel = level; } // nullptr = gerak gak dicek ke tembok
+    void SetAiLod(const AiLodConfig& config);
+    // Kerucut pandang kamera (buat "di luar layar"). Gak di-set (headless) = semua dianggap kelihatan
+    void SetViewCone(Vector3 eye, Vector3 forward, float cosHalfAngle);
+    void UpdateBehaviors(float dt, Vector3 playerPos); // Batch per tipe
+    // Crowd separation (abis UpdateBehaviors). Grid-nya diisi ulang jadi grid TITIK (cuma buat pass ini),
+    // dorongan di-sweep ke tembok per cell (SweepMove -> LevelManager::ResolveCircle)
+    void ApplySeparation(SpatialHashGrid& grid, float dt);
+    // Gerak cepat (dash charger): dipecah per maxStepDistance, tiap potong di-clamp ke tembok
+    Vector3 SweepMove(Vector3 from, Vector3 delta, float r) const;
+    void TakeDamage(int row, float amount);
+    void FireBullet(const EnemyBullet& bullet); // Shooter & Boss nembak lewat sini (masuk pool)
+
+    // --- RENDER ---
+    void SubmitShadows(float alpha, ShadowBatch& shadows); // Blob shadow semua musuh (sebelum Draw)
+    void Draw(float alpha, const EnemyDrawContext& ctx);
+    // Body kubus: masuk ctx.batches kalau ada, kalau gak langsung DrawMesh
+    void DrawCubeBody(const EnemyDrawContext& ctx, const Matrix& transform, Color color);
+    void CountDrawCalls(int calls) { mDrawStats.drawCalls += calls; } // Draw langsung di luar helper
+    const EnemyDrawStats& DrawStats() const { return mDrawStats; }
+
+    // --- QUERY ---
+    int Count() const { return mCount; }
+    int TotalRows() const { return (int)type.size(); }
+    bool IsActive(int row) const { return active[row] != 0; }
+    bool HasCapability(int row, unsigned int cap) const { return (capabilities[row] & cap) != 0; }
+    const std::vector<int>& RowsOfType(EnemyType t) const { return mRowsByType[(int)t]; }
+    const EnemyAllocStats& AllocStats() const { return mAllocStats; }
+    const AiLodConfig& AiLod() const { return mAiLod; }
+    const AiLodStats& AiStats() const { return mAiStats; }
+
+    // --- COLUMNS (hot) ---
+    std::vector<EnemyType> type;
+    std::vector<unsigned int> capabilities;
+    std::vector<unsigned char> active;
+    std::vector<Vector3> position;
+    std::vector<Vector3> prevPosition;
+    std::vector<Vector3> velocity;
+    std::vector<float> radius;
+    std::vector<float> hp;
+    std::vector<float> flashTimer;
+    std::vector<float> speed;
+    std::vector<Vector3> chaseDir; // Arah jalan ke player tick ini (flow field / lurus), XZ ternormalisasi
+    std::vector<float> aiDt;       // dt yang dipakai behavior tick ini (0 = skip, AI LOD)
+    std::vector<float> aiAccum;    // dt yang ditabung sejak update terakhir
+    std::vector<unsigned char> aiInterval; // Update tiap N tick (1 = full), diklasifikasi ulang tiap 8 tick
+
+    // --- COLUMNS (stats & visual) ---
+    std::vector<int> tier;
+    std::vector<float> maxHp;
+    std::vector<int> xpReward;
+    std::vector<float> scaleSize;
+    std::vector<Color> bodyColor;
+    std::vector<unsigned char> canSplit;
+
+    // --- COLUMNS (state per tipe, arti tergantung tipe) ---
+    std::vector<unsigned char> state;   // Charger: ChargerState | Exploder: armed | Slime/Rat: lagi lompat
+    std::vector<float> stateTimer;      // Charger: timer state | Exploder: fuse | Slime/Rat: jump timer | Shooter: shoot timer
+    std::vector<Vector3> moveDir;       // Charger: arah dash | Slime: arah lompat
+    std::vector<float> attackRange;     // Exploder: radius ledakan | Shooter: jarak tembak
+    std::vector<float> attackPower;     // Exploder: damage ledakan | Charger: dash speed
+    std::vector<float> attackCooldown;  // Shooter
+    std::vector<float> animTimer;       // Rat
+    std::vector<unsigned char> variant; // Slime: SlimeVariant | Rat: RatModelType
+    std::vector<ItemType> lootType;     // Slime
+    std::vector<int> lootTier;          // Slime (weapon drop tier)
+
+    // --- SIDE TABLE ---
+    std::vector<BossState> bosses; // Otak boss (jarang, jadi gak dibikin kolom)
+
+private:
+    int AddRow(EnemyType t, int tierInput, Vector3 pos);
+    void MoveRow(int from, int to);
+    void ResizeColumns(int rows);
+    void RebuildTypeLists();
+
+    void ScheduleAi(float dt, Vector3 playerPos);
+    void UpdateChaseDirections(Vector3 playerPos);
+    void ResolveWallContacts(); // Abis semua UpdateBatch: row yang gerak didorong keluar tembok
+    Vector3 ClampToWalls(Vector3 from, Vector3 to, float r) const; // ResolveCircle + batal kalau tembus
+
+    int mCount;
+    const FlowField* mFlowField;
+    EnemyProjectilePool* mProjectiles;
+    const LevelManager* mLevel;
+
+    // AI LOD
+    AiLodConfig mAiLod;
+    AiLodStats mAiStats;
+    std::vector<int> mScheduled[(int)EnemyType::COUNT]; // Row per tipe yang update tick ini
+    unsigned int mAiTick;
+    bool mHasViewCone;
+    Vector3 mViewEye;
+    Vector3 mViewForward;
+    float mViewCosHalfAngle;
+    std::vector<int> mRowsByType[(int)EnemyType::COUNT];
+    std::vector<int> mRemap; // Scratch Compact: row lama -> row baru (-1 = dibuang)
+    EnemyAllocStats mAllocStats;
+    EnemyDrawStats mDrawStats;
+
+    // Scratch separation (kapasitas ikut Reserve)
+    std::vector<Vector3> mSeparationPush;
+    std::vector<int> mNeighbors;
+};
+
+// Helper warna kedip (80% putih) - dipake semua Draw per tipe
+Color EnemyFlashColor(Color originalColor, float flashTimer);
+
+// Transform body = sama persis kayak DrawModelEx(pos, sumbu Y, rotasi derajat, scale)
+Matrix EnemyBodyTransform(Vector3 position, float rotationYDeg, Vector3 scale);
@@ -1,25 +1,17 @@
 #pragma once
-#include "BaseEnemy.h"
 #include "raylib.h"
+#include <vector>
 
-class ExploderEnemy : public BaseEnemy {
-public:
-    ExploderEnemy(int tier, Vector3 startPos);
-    
-    void Update(float dt, Vector3 playerPos) override;
-    void Draw(Model& slimeModel, Model& cubeModel, Model& magnetModel, 
-              Model& shadowPlane, Camera3D cam, Vector3 playerPos) override;
+class EnemyStore;
+struct EnemyDrawContext;
 
-    // ✅ EXPLOSION CHECK
-    bool ShouldExplode(Vector3 playerPos);
-    float GetExplosionRadius() const { return mExplosionRadius; }
-    float GetExplosionDamage() const { return mExplosionDamage; }
+// Exploder: lari ke player, nyalain sumbu kalau deket, lalu meledak.
+// Kolom: state (1 = armed), stateTimer (fuse), attackRange (radius ledakan), attackPower (damage)
+namespace ExploderEnemy {
+    void Init(EnemyStore& store, int row);
+    void UpdateBatch(EnemyStore& store, const std::vector<int>& rows, Vector3 playerPos);
+    void Draw(EnemyStore& store, int row, Vector3 position, const EnemyDrawContext& ctx);
 
-private:
-    float mFuseTimer;
-    float mExplosionRadius;
-    float mExplosionDamage;
-    bool mIsArmed;
-    Color bodyColor;
-    float scaleSize;
-};
\ No newline at end of file
+    // ✅ EXPLOSION CHECK (fuse habis -> Game yang ngurus damage + matiin row)
+    bool ShouldExplode(const EnemyStore& store, int row);
+}
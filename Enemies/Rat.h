@@ -1,35 +1,27 @@
 #pragma once
-#include "BaseEnemy.h"
 #include "raylib.h"
+#include <vector>
+
+class EnemyStore;
+struct EnemyDrawContext;
 
 // 🐀 ENUM MODEL TYPE
-enum class RatModelType {
+enum class RatModelType : unsigned char {
     NORMAL,      // Rat.glb (Kecil-sedang, bisa warna-warni)
     HAMSTER,     // Hamster.glb (Sedang, oren)
     SPINY_BOSS   // Spiny_mouse.glb (Gede, buat boss/elite)
 };
 
-class Rat : public BaseEnemy {
-public:
-    Rat(int tierInput, Vector3 startPos);
+// Tikus: jalan ngejar + lompat kecil random.
+// Kolom: stateTimer (jump timer), velocity.y (jump velocity), state (lagi lompat), animTimer, variant (RatModelType)
+namespace Rat {
+    void Init(EnemyStore& store, int row);
+    void UpdateBatch(EnemyStore& store, const std::vector<int>& rows, Vector3 playerPos);
 
-    void Update(float dt, Vector3 playerPos) override;
-    void Draw(Model& slimeModel, Model& cubeModel, Model& magnetModel, Model& shadowPlane, 
-              Camera3D cam, Vector3 playerPos) override;
+    // Draw fallback (Pake Cube kalau model belum ada)
+    void Draw(EnemyStore& store, int row, Vector3 position, const EnemyDrawContext& ctx);
 
     // ✅ DRAW DENGAN MODEL TIKUS ASLI
-    void DrawWithRatModels(Model& ratModel, Model& hamsterModel, Model& spinyModel, 
-                          Model& shadowPlane, Vector3 playerPos);
-
-private:
-    float mAnimTimer;
-    float mJumpTimer;
-    float mJumpVelocity;
-    bool mIsJumping;
-    
-    Color bodyColor;
-    float scaleSize;
-    
-    // ✅ MODEL SELECTION
-    RatModelType modelType;
-};
\ No newline at end of file
+    void DrawWithRatModels(EnemyStore& store, int row, Vector3 position, Model& ratModel, Model& hamsterModel,
+                           Model& spinyModel, Vector3 playerPos);
+}
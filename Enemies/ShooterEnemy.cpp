@@ -1,111 +1,96 @@
 #include "ShooterEnemy.h"
+#include "EnemyStore.h"
+#include "../Systems/EnemyProjectilePool.h"
 #include "../Utils/MathUtils.h"
 #include "raymath.h"
 #include <cmath>
 #include <algorithm>
 
-ShooterEnemy::ShooterEnemy(int tier, Vector3 startPos) : BaseEnemy(tier, startPos) {
-    this->tier = tier;
-    position = startPos;
-    velocity = {0, 0, 0};
-    active = true;
-    mShootTimer = 0.0f;
+void ShooterEnemy::Init(EnemyStore& s, int row) {
+    int tier = s.tier[row];
+    s.stateTimer[row] = 0.0f;
 
     // 🔥 STATS BASED ON TIER
     if (tier == 1) {
-        hp = 30;
-        speed = 3.0f;           // Lambat (kiting enemy)
-        radius = 1.0f;
-        xpReward = 30;
-        bodyColor = ORANGE;
-        scaleSize = 1.0f;
-        mShootCooldown = 2.0f;  // Nembak tiap 2 detik
-        mShootRange = 20.0f;    // Range 20 meter
+        s.hp[row] = 30;
+        s.speed[row] = 3.0f;            // Lambat (kiting enemy)
+        s.radius[row] = 1.0f;
+        s.xpReward[row] = 30;
+        s.bodyColor[row] = ORANGE;
+        s.scaleSize[row] = 1.0f;
+        s.attackCooldown[row] = 2.0f;   // Nembak tiap 2 detik
+        s.attackRange[row] = 20.0f;     // Range 20 meter
     } 
     else if (tier == 2) {
-        hp = 80;
-        speed = 2.5f;
-        radius = 1.3f;
-        xpReward = 100;
-        bodyColor = YELLOW;
-        scaleSize = 1.3f;
-        mShootCooldown = 1.5f;  // Lebih cepet
-        mShootRange = 25.0f;
+        s.hp[row] = 80;
+        s.speed[row] = 2.5f;
+        s.radius[row] = 1.3f;
+        s.xpReward[row] = 100;
+        s.bodyColor[row] = YELLOW;
+        s.scaleSize[row] = 1.3f;
+        s.attackCooldown[row] = 1.5f;   // Lebih cepet
+        s.attackRange[row] = 25.0f;
     }
     else {
-        hp = 200;
-        speed = 2.0f;
-        radius = 1.8f;
-        xpReward = 300;
-        bodyColor = GOLD;
-        scaleSize = 1.8f;
-        mShootCooldown = 1.0f;  // Rapid fire
-        mShootRange = 30.0f;
+        s.hp[row] = 200;
+        s.speed[row] = 2.0f;
+        s.radius[row] = 1.8f;
+        s.xpReward[row] = 300;
+        s.bodyColor[row] = GOLD;
+        s.scaleSize[row] = 1.8f;
+        s.attackCooldown[row] = 1.0f;   // Rapid fire
+        s.attackRange[row] = 30.0f;
     }
 }
 
-void ShooterEnemy::Update(float dt, Vector3 playerPos) {
-    if (!active) return;
+void ShooterEnemy::UpdateBatch(EnemyStore& s, const std::vector<int>& rows, Vector3 playerPos) {
+    for (int row : rows) {
+        if (!s.active[row]) continue;
+        float dt = s.aiDt[row];
 
-    UpdateFlash(dt);
+        Vector3 position = s.position[row];
+        float speed = s.speed[row];
+        float shootRange = s.attackRange[row];
 
-    // --- 1. MOVEMENT (Keep distance from player) ---
-    Vector3 toPlayer = Vector3Subtract(playerPos, position);
-    toPlayer.y = 0;
-    float distToPlayer = Vector3Length(toPlayer);
-    
-    // Kiting behavior: Jaga jarak optimal (15 meter)
-    float optimalRange = 15.0f;
-    
-    if (distToPlayer < optimalRange) {
-        // Terlalu deket, mundur
-        Vector3 dir = Vector3Normalize(toPlayer);
-        position = Vector3Subtract(position, Vector3Scale(dir, speed * dt));
-    } 
-    else if (distToPlayer > mShootRange) {
-        // Terlalu jauh, maju
-        Vector3 dir = Vector3Normalize(toPlayer);
-        position = Vector3Add(position, Vector3Scale(dir, speed * dt));
-    }
-    // Else: Perfect range, stay still
-
-    // --- 2. SHOOTING ---
-    mShootTimer -= dt;
-    
-    if (distToPlayer <= mShootRange && mShootTimer <= 0) {
-        Shoot(playerPos);
-        mShootTimer = mShootCooldown;
-    }
-
-    // --- 3. UPDATE BULLETS ---
-    for (auto& b : mBullets) {
-        if (!b.active) continue;
+        // --- 1. MOVEMENT (Keep distance from player) ---
+        Vector3 toPlayer = Vector3Subtract(playerPos, position);
+        toPlayer.y = 0;
+        float distToPlayer = Vector3Length(toPlayer);
         
-        b.position = Vector3Add(b.position, Vector3Scale(b.direction, b.speed * dt));
-        b.lifeTime -= dt;
+        // Kiting behavior: Jaga jarak optimal (15 meter)
+        float optimalRange = 15.0f;
         
-        if (b.lifeTime <= 0) b.active = false;
+        if (distToPlayer < optimalRange) {
+            // Terlalu deket, mundur
+            Vector3 dir = Vector3Normalize(toPlayer);
+            position = Vector3Subtract(position, Vector3Scale(dir, speed * dt));
+        } 
+        else if (distToPlayer > shootRange) {
+            // Terlalu jauh, maju (ikut flow field)
+            position = Vector3Add(position, Vector3Scale(s.chaseDir[row], speed * dt));
+        }
+        // Else: Perfect range, stay still
+        s.position[row] = position;
+
+        // --- 2. SHOOTING ---
+        s.stateTimer[row] -= dt;
         
-        // Cek kena tanah
-        if (b.position.y <= 0) b.active = false;
+        if (distToPlayer <= shootRange && s.stateTimer[row] <= 0) {
+            Shoot(s, row, playerPos);
+            s.stateTimer[row] = s.attackCooldown[row];
+        }
+
+        // Gravity
+        Vector3& pos = s.position[row];
+        if (pos.y > 0) pos.y -= 10.0f * dt;
+        if (pos.y < 0) pos.y = 0;
     }
-
-    // Cleanup
-    mBullets.erase(
-        std::remove_if(mBullets.begin(), mBullets.end(),
-            [](const EnemyBullet& b) { return !b.active; }),
-        mBullets.end()
-    );
-
-    // Gravity
-    if (position.y > 0) position.y -= 10.0f * dt;
-    if (position.y < 0) position.y = 0;
 }
 
-void ShooterEnemy::Shoot(Vector3 targetPos) {
+void ShooterEnemy::Shoot(EnemyStore& s, int row, Vector3 targetPos) {
     EnemyBullet b;
-    b.position = position;
-    b.position.y += radius * 0.7f; // Spawn dari tengah body
+    b.position = s.position[row];
+    b.position.y += s.radius[row] * 0.7f; // Spawn dari tengah body
     
     Vector3 dir = Vector3Subtract(targetPos, b.position);
     dir.y = 0; // Shoot horizontal
@@ -114,24 +99,21 @@ void ShooterEnemy::Shoot(Vector3 targetPos) {
     b.speed = 3*15.0f;
     b.damage = 10.0f;
     b.radius = 0.1f;
-    b.active = true;
     b.lifeTime = 5.0f/3.0f; // 1.667 seconds
+    b.color = s.bodyColor[row]; // Glow peluru ikut warna body
+    b.fromBoss = false;
     
-    mBullets.push_back(b);
+    s.FireBullet(b);
 }
 
-void ShooterEnemy::Draw(Model& slimeModel, Model& cubeModel, Model& magnetModel, 
-                        Model& shadowPlane, Camera3D cam, Vector3 playerPos) {
-    if (!active) return;
+void ShooterEnemy::Draw(EnemyStore& s, int row, Vector3 position, const EnemyDrawContext& ctx) {
+    float scaleSize = s.scaleSize[row];
+    Color bodyColor = s.bodyColor[row];
 
-    // --- 1. SHADOW (Tetap) ---
-    float shadowScale = radius * 2.2f;
-    DrawModelEx(shadowPlane, {position.x, 0.02f, position.z}, 
-                {0, 1, 0}, 0.0f, {shadowScale, 1.0f, shadowScale}, 
-                ColorAlpha(BLACK, 0.4f));
+    // --- 1. SHADOW: batch (EnemyStore::SubmitShadows) ---
 
     // --- 2. BODY ROTATION (Tetap) ---
-    Vector3 dir = Vector3Subtract(playerPos, position);
+    Vector3 dir = Vector3Subtract(ctx.playerPos, position);
     float rotationY = atan2f(dir.x, dir.z) * RAD2DEG;
 
     // --- 3. BODY DRAW (Tetap + Hit Effect) ---
@@ -139,48 +121,15 @@ void ShooterEnemy::Draw(Model& slimeModel, Model& cubeModel, Model& magnetModel,
     Vector3 drawPos = position;
     drawPos.y += scale.y * 0.5f;
 
-    Color finalColor = GetRenderColor(bodyColor);
+    Color finalColor = EnemyFlashColor(bodyColor, s.flashTimer[row]);
 
-    cubeModel.materials[0].maps[MATERIAL_MAP_DIFFUSE].color = finalColor;
-    DrawModelEx(cubeModel, drawPos, {0, 1, 0}, rotationY, scale, WHITE);
-    cubeModel.materials[0].maps[MATERIAL_MAP_DIFFUSE].color = WHITE;
+    s.DrawCubeBody(ctx, EnemyBodyTransform(drawPos, rotationY, scale), finalColor);
 
     // --- 4. BARREL (Tetap) ---
-    Color barrelColor = (flashTimer > 0) ? WHITE : DARKGRAY;
+    Color barrelColor = (s.flashTimer[row] > 0) ? WHITE : DARKGRAY;
     Vector3 barrelOffset = Vector3RotateByAxisAngle({0, 0, scaleSize * 1.0f}, {0, 1, 0}, rotationY * DEG2RAD);
     Vector3 barrelPos = Vector3Add(drawPos, barrelOffset);
     DrawCylinder(barrelPos, 0.15f, 0.15f, 0.5f, 8, barrelColor);
 
-    // --- 5. 🔥 UPGRADED BULLET VISUALS ---
-    
-    // Aktifkan Additive Blending (Warna bertumpuk jadi makin terang/glowing)
-    BeginBlendMode(BLEND_ADDITIVE); 
-
-    for (const auto& b : mBullets) {
-        if (!b.active) continue;
-
-        // Tentukan warna bullet (lebih terang dari body musuh)
-        Color glowColor = bodyColor;
-        Color coreColor = WHITE;
-
-        // Hitung posisi Ekor (Trail)
-        // Ekor memanjang ke BELAKANG arah gerak peluru
-        float trailLength = 1.5f; // Panjang ekor visual
-        Vector3 tailPos = Vector3Subtract(b.position, Vector3Scale(b.direction, trailLength));
-
-        // A. Gambar Glow Sphere (Aura luar)
-        DrawSphere(b.position, b.radius * 1.2f, ColorAlpha(glowColor, 0.4f));
-
-        // B. Gambar Core Cylinder (Badan peluru memanjang)
-        // Dari Ekor (kecil) ke Kepala (besar)
-        DrawCylinderEx(tailPos, b.position, b.radius * 0.1f, b.radius * 0.6f, 6, glowColor);
-
-        // C. Gambar Hot Core Line (Inti laser putih di tengah)
-        DrawLine3D(tailPos, b.position, coreColor);
-        
-        // D. Spark di kepala peluru (Titik impact/depan)
-        DrawSphere(b.position, b.radius * 0.4f, coreColor);
-    }
-
-    EndBlendMode(); // Matikan blending additive
-}
\ No newline at end of file
+    // Peluru digambar EnemyProjectilePool (semua shooter 1 blend pass)
+}
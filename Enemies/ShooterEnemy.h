@@ -1,37 +1,16 @@
 #pragma once
-#include "BaseEnemy.h"
 #include "raylib.h"
 #include <vector>
 
-// Peluru musuh (beda dari player)
-struct EnemyBullet {
-    Vector3 position;
-    Vector3 direction;
-    float speed;
-    float damage;
-    float radius;
-    bool active;
-    float lifeTime;
-};
+class EnemyStore;
+struct EnemyDrawContext;
 
-class ShooterEnemy : public BaseEnemy {
-public:
-    ShooterEnemy(int tier, Vector3 startPos);
-    
-    void Update(float dt, Vector3 playerPos) override;
-    void Draw(Model& slimeModel, Model& cubeModel, Model& magnetModel, 
-              Model& shadowPlane, Camera3D cam, Vector3 playerPos) override;
+// Shooter: jaga jarak (kiting) + nembak peluru lurus.
+// Kolom: stateTimer (shoot timer), attackCooldown, attackRange (peluru masuk EnemyProjectilePool)
+namespace ShooterEnemy {
+    void Init(EnemyStore& store, int row);
+    void UpdateBatch(EnemyStore& store, const std::vector<int>& rows, Vector3 playerPos);
+    void Draw(EnemyStore& store, int row, Vector3 position, const EnemyDrawContext& ctx);
 
-    void Shoot(Vector3 targetPos);
-    std::vector<EnemyBullet>& GetBullets() { return mBullets; }
-
-private:
-    // Variable yang dibutuhkan di .cpp
-    float mShootTimer;
-    float mShootCooldown;
-    float mShootRange;
-    std::vector<EnemyBullet> mBullets;
-    
-    Color bodyColor;
-    float scaleSize;
-};
\ No newline at end of file
+    void Shoot(EnemyStore& store, int row, Vector3 targetPos);
+}
@@ -1,104 +1,104 @@
 #include "SlimeJumper.h"
+#include "EnemyStore.h"
 #include "raymath.h"
 #include <cmath>
 #include "rlgl.h"
 
-SlimeJumper::SlimeJumper(int tierInput, Vector3 startPos) : BaseEnemy(tierInput, startPos) {
-    tier = tierInput;
-    position = startPos;
-    velocity = {0, 0, 0};
-    active = true;
+void SlimeJumper::Init(EnemyStore& s, int row) {
+    int tier = s.tier[row];
 
-    if (tier == 1) { hp = 30; speed = 6.0f; radius = 1.0f; xpReward = 25; }
-    else if (tier == 2) { hp = 100; speed = 4.5f; radius = 1.5f; xpReward = 80; }
-    else { hp = 500; speed = 3.0f; radius = 3.0f; xpReward = 500; }
+    if (tier == 1) { s.hp[row] = 30; s.speed[row] = 6.0f; s.radius[row] = 1.0f; s.xpReward[row] = 25; }
+    else if (tier == 2) { s.hp[row] = 100; s.speed[row] = 4.5f; s.radius[row] = 1.5f; s.xpReward[row] = 80; }
+    else { s.hp[row] = 500; s.speed[row] = 3.0f; s.radius[row] = 3.0f; s.xpReward[row] = 500; }
 
-    jumpTimer = GetRandomValue(0, 100) / 100.0f;
-    isJumping = false;
-    verticalSpeed = 0;
+    s.stateTimer[row] = GetRandomValue(0, 100) / 100.0f;
+    s.state[row] = 0;
+    s.velocity[row] = {0, 0, 0};
 
-    // ✅ RANDOM VARIANT SYSTEM
-    // 70% = Basic (Box), 30% = Special (Magnet/Loot)
+    // ✅ DROP SYSTEM (RNG)
+    SlimeVariant variant;
     int roll = GetRandomValue(1, 100);
-    if (roll <= 70) {
-        variant = SlimeVariant::BASIC;
-        hasLoot = false;
-    } else {
-        variant = SlimeVariant::MAGNET;
-        hasLoot = true;
-    }
-
-     // ✅ DROP SYSTEM (RNG)
     
     if (roll <= 50) {
         // 50% = Gak drop apa-apa
         variant = SlimeVariant::BASIC;
-        hasLoot = false;
-        lootType = ItemType::NONE;
+        s.lootType[row] = ItemType::NONE;
     } 
     else if (roll <= 70) {
         // 20% = Drop Magnet
         variant = SlimeVariant::MAGNET;
-        hasLoot = true;
-        lootType = ItemType::MAGNET;
+        s.lootType[row] = ItemType::MAGNET;
     }
     else if (roll <= 85) {
         // 15% = Drop HP Pack
         variant = SlimeVariant::HEALTH;
-        hasLoot = true;
-        lootType = ItemType::HEALTH_PACK;
+        s.lootType[row] = ItemType::HEALTH_PACK;
     }
     else {
         // 15% = Drop Weapon (Random tier)
         variant = SlimeVariant::WEAPON;
-        hasLoot = true;
-        lootType = ItemType::WEAPON_DROP;
-        weaponDropTier = GetRandomValue(0, 3); // 0-3 (Pistol-Bazooka)
+        s.lootType[row] = ItemType::WEAPON_DROP;
+        s.lootTier[row] = GetRandomValue(0, 3); // 0-3 (Pistol-Bazooka)
     }
+    s.variant[row] = (unsigned char)variant;
 }
 
-// ✅ Getter baru
-ItemType SlimeJumper::GetLootType() const {
-    return lootType;
+bool SlimeJumper::HasLoot(const EnemyStore& s, int row) {
+    return s.lootType[row] != ItemType::NONE;
 }
 
-int SlimeJumper::GetWeaponDropTier() const {
-    return weaponDropTier;
-
+ItemType SlimeJumper::GetLootType(const EnemyStore& s, int row) {
+    return s.lootType[row];
 }
 
-void SlimeJumper::Update(float dt, Vector3 playerPos) {
-
-    UpdateFlash(dt);
+int SlimeJumper::GetWeaponDropTier(const EnemyStore& s, int row) {
+    return s.lootTier[row];
+}
 
-    if (!isJumping) {
-        jumpTimer += dt;
-        if (jumpTimer > 1.5f) {
-            isJumping = true;
-            verticalSpeed = 10.0f;
+void SlimeJumper::UpdateBatch(EnemyStore& s, const std::vector<int>& rows, Vector3 playerPos) {
+    for (int row : rows) {
+        if (!s.active[row]) continue;
+        float dt = s.aiDt[row];
+
+        Vector3& position = s.position[row];
+        Vector3& jumpDir = s.moveDir[row];
+        float& verticalSpeed = s.velocity[row].y;
+        float speed = s.speed[row];
+
+        if (!s.state[row]) {
+            s.stateTimer[row] += dt;
+            if (s.stateTimer[row] > 1.5f) {
+                s.state[row] = 1;
+                verticalSpeed = 10.0f;
+                
+                jumpDir = s.chaseDir[row];
+                s.stateTimer[row] = 0;
+            }
+        } else {
+            // Fisika Lompat
+            position.y += verticalSpeed * dt;
+            verticalSpeed -= 30.0f * dt;
             
-            Vector3 dir = Vector3Subtract(playerPos, position);
-            dir.y = 0;
-            jumpDir = Vector3Normalize(dir);
-            jumpTimer = 0;
-        }
-    } else {
-        // Fisika Lompat
-        position.y += verticalSpeed * dt;
-        verticalSpeed -= 30.0f * dt;
-        
-        position.x += jumpDir.x * speed * 2.0f * dt;
-        position.z += jumpDir.z * speed * 2.0f * dt;
+            position.x += jumpDir.x * speed * 2.0f * dt;
+            position.z += jumpDir.z * speed * 2.0f * dt;
 
-        if (position.y <= 0) {
-            position.y = 0;
-            isJumping = false;
+            if (position.y <= 0) {
+                position.y = 0;
+                s.state[row] = 0;
+            }
         }
     }
 }
 
-void SlimeJumper::Draw(Model& slimeModel, Model& cubeModel, Model& magnetModel, Model& shadowPlane, Camera3D cam, Vector3 playerPos) 
+void SlimeJumper::Draw(EnemyStore& s, int row, Vector3 position, const EnemyDrawContext& ctx) 
 {
+    Model& slimeModel = *ctx.slimeModel;
+    Model& magnetModel = *ctx.magnetModel;
+    int tier = s.tier[row];
+    float radius = s.radius[row];
+    float flashTimer = s.flashTimer[row];
+    SlimeVariant variant = (SlimeVariant)s.variant[row];
+
     // --- 1. SETUP WARNA DASAR (TIER & VARIANT) ---
     Color baseColor = (Color){ 0, 180, 255, 255 }; // Cyan (Tier 1)
     
@@ -133,62 +133,57 @@ void SlimeJumper::Draw(Model& slimeModel, Model& cubeModel, Model& magnetModel,
     Vector3 centerPos = position;
     centerPos.y += radius * stretch * 0.5f;
 
-    // --- 4. RENDER SHADOW ---
-    rlDisableDepthMask();
-    float shadowScale = (radius * 2.5f) * (1.0f / (1.0f + position.y * 0.5f)); 
-    DrawModelEx(shadowPlane, 
-                (Vector3){position.x, 0.02f, position.z}, 
-                (Vector3){0, 1, 0}, 0.0f, 
-                (Vector3){shadowScale, 1.0f, shadowScale}, 
-                (Color){0, 0, 0, 120});
-    rlEnableDepthMask();
+    // --- 4. SHADOW: batch (EnemyStore::SubmitShadows), makin tinggi lompat makin kecil ---
 
     // --- 5. RENDER INNER OBJECT (BOX / MAGNET) ---
-    rlPushMatrix();
-        rlTranslatef(centerPos.x, centerPos.y, centerPos.z);
-        
-        float time = GetTime();
-        rlRotatef(time * 50.0f, 0, 1, 0);
-        rlRotatef(sinf(time * 2.0f) * 15.0f, 1, 0, 0); 
-        rlRotatef(cosf(time * 1.5f) * 10.0f, 0, 0, 1);
-
-        float baseScale = 0.004f; 
-        float itemScale = baseScale * radius;
-        Vector3 modelScale = { itemScale, itemScale, itemScale };
-
-        // Tentukan Warna Inner Object
-        Color innerTint;
-        
-        if (variant == SlimeVariant::BASIC) {
-            innerTint = (Color){ 200, 180, 160, 255 }; // Coklat Pudar
-        } else {
-            innerTint = (Color){ 220, 200, 180, 255 }; // Krem Magnet
-            if (tier == 2) innerTint = (Color){ 180, 220, 255, 255 };
-        }
+    float time = GetTime();
+    float baseScale = 0.004f; 
+    float itemScale = baseScale * radius;
+    Vector3 modelScale = { itemScale, itemScale, itemScale };
+
+    // Goyangan isi slime (urutan sama kayak rlTranslatef lalu rlRotatef Y, X, Z, -90 Z)
+    Matrix innerSpin = MatrixTranslate(centerPos.x, centerPos.y, centerPos.z);
+    innerSpin = MatrixMultiply(MatrixRotateY(time * 50.0f * DEG2RAD), innerSpin);
+    innerSpin = MatrixMultiply(MatrixRotateX(sinf(time * 2.0f) * 15.0f * DEG2RAD), innerSpin);
+    innerSpin = MatrixMultiply(MatrixRotateZ(cosf(time * 1.5f) * 10.0f * DEG2RAD), innerSpin);
+    innerSpin = MatrixMultiply(MatrixRotateZ(-90.0f * DEG2RAD), innerSpin);
+
+    // Tentukan Warna Inner Object
+    Color innerTint;
+    
+    if (variant == SlimeVariant::BASIC) {
+        innerTint = (Color){ 200, 180, 160, 255 }; // Coklat Pudar
+    } else {
+        innerTint = (Color){ 220, 200, 180, 255 }; // Krem Magnet
+        if (tier == 2) innerTint = (Color){ 180, 220, 255, 255 };
+    }
 
-        // 🔥 LOGIKA FLASH "HAMPIR PUTIH" (INNER OBJECT)
-        if (flashTimer > 0) {
-            float mixFactor = 0.8f; // 80% Putih
-            innerTint.r = (unsigned char)(255 * mixFactor + innerTint.r * (1.0f - mixFactor));
-            innerTint.g = (unsigned char)(255 * mixFactor + innerTint.g * (1.0f - mixFactor));
-            innerTint.b = (unsigned char)(255 * mixFactor + innerTint.b * (1.0f - mixFactor));
-        }
+    // 🔥 LOGIKA FLASH "HAMPIR PUTIH" (INNER OBJECT)
+    innerTint = EnemyFlashColor(innerTint, flashTimer);
 
-        // Render Model Dalam
-        if (variant == SlimeVariant::BASIC) {
-            rlRotatef(-90.0f, 0, 0, 1);
-            DrawModelEx(cubeModel, Vector3Zero(), (Vector3){0,1,0}, 0.0f, 
-                        (Vector3){itemScale * 200, itemScale * 200, itemScale * 200}, innerTint);
-        } 
-        else if (variant == SlimeVariant::MAGNET) {
-            rlRotatef(-90.0f, 0, 0, 1);
-            float pulse = 1.0f + sinf(time * 5.0f) * 0.1f;
+    // Render Model Dalam
+    if (variant == SlimeVariant::BASIC) {
+        // Kotak = mesh cube juga, jadi ikut batch body kubus
+        float boxSize = itemScale * 200;
+        s.DrawCubeBody(ctx, MatrixMultiply(MatrixScale(boxSize, boxSize, boxSize), innerSpin), innerTint);
+    } 
+    else if (variant == SlimeVariant::MAGNET) {
+        float pulse = 1.0f + sinf(time * 5.0f) * 0.1f;
+        rlPushMatrix();
+            rlMultMatrixf(MatrixToFloat(innerSpin));
             DrawModelEx(magnetModel, Vector3Zero(), (Vector3){0,1,0}, 0.0f, 
                         Vector3Scale(modelScale, pulse), innerTint);
-        }
-    rlPopMatrix();
+        rlPopMatrix();
+        s.CountDrawCalls(magnetModel.meshCount);
+    }
 
     // --- 6. RENDER OUTER SHELL (SLIME SKIN) ---
+    // Instancing: warna flash ikut per-instance, blend & depth diurus pas flush (1x buat semua slime)
+    if (ctx.batches) {
+        ctx.batches->slimeShells.Add(EnemyBodyTransform(centerPos, 0.0f, scale), ColorFromNormalized(shaderColorVec));
+        return;
+    }
+
     // 🔥 FORCE BLEND MODE (Agar Alpha Shader Kebaca)
     BeginBlendMode(BLEND_ALPHA);
     rlDisableDepthMask(); 
@@ -202,13 +197,5 @@ void SlimeJumper::Draw(Model& slimeModel, Model& cubeModel, Model& magnetModel,
         
     rlEnableDepthMask(); 
     EndBlendMode(); // Reset blending
+    s.CountDrawCalls(1);
 }
-
-// ✅ GETTER UNTUK LOOT CHECK
-bool SlimeJumper::HasLoot() const {
-    return hasLoot;
-}
-
-SlimeVariant SlimeJumper::GetVariant() const {
-    return variant;
-}
\ No newline at end of file
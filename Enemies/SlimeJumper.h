@@ -1,37 +1,28 @@
 #pragma once
-#include "BaseEnemy.h"
-#include "raymath.h"
-#include "../Systems/ItemManager.h" // ✅ Include ItemManager
+#include "raylib.h"
+#include "../Systems/ItemManager.h" // ✅ ItemType
+#include <vector>
 
-enum class SlimeVariant {
+class EnemyStore;
+struct EnemyDrawContext;
+
+enum class SlimeVariant : unsigned char {
     BASIC,   // Gak drop apa-apa
     MAGNET,  // Drop magnet
     HEALTH,  // Drop HP
     WEAPON   // Drop weapon crate
 };
 
-class SlimeJumper : public BaseEnemy {
-public:
-    SlimeJumper(int tier, Vector3 startPos);
-    
-    void Update(float dt, Vector3 playerPos) override;
-    void Draw(Model& slimeModel, Model& cubeModel, Model& magnetModel, Model& shadowPlane, 
-              Camera3D cam, Vector3 playerPos) override;
-
-    // ✅ GETTERS
-    bool HasLoot() const;
-    SlimeVariant GetVariant() const;
-    ItemType GetLootType() const;        // ✅ BARU
-    int GetWeaponDropTier() const;       // ✅ BARU
+// Slime: lompat-lompat ke arah player, bisa bawa loot.
+// Kolom: state (1 = lagi lompat), stateTimer (jump timer), moveDir (arah lompat),
+//        velocity.y (kecepatan vertikal), variant, lootType, lootTier
+namespace SlimeJumper {
+    void Init(EnemyStore& store, int row);
+    void UpdateBatch(EnemyStore& store, const std::vector<int>& rows, Vector3 playerPos);
+    void Draw(EnemyStore& store, int row, Vector3 position, const EnemyDrawContext& ctx);
 
-private:
-    float jumpTimer;
-    bool isJumping;
-    float verticalSpeed;
-    Vector3 jumpDir;
-    
-    SlimeVariant variant;
-    bool hasLoot;
-    ItemType lootType;        // ✅ BARU
-    int weaponDropTier;       // ✅ BARU (0-3)
-};
\ No newline at end of file
+    // ✅ GETTERS (loot check pas mati)
+    bool HasLoot(const EnemyStore& store, int row);
+    ItemType GetLootType(const EnemyStore& store, int row);
+    int GetWeaponDropTier(const EnemyStore& store, int row);
+}
@@ -2,6 +2,7 @@
 #include <cmath>
 #include <algorithm>
 #include <iostream>
+#include <chrono>
 #include "rlgl.h"
 
 #include "Enemies/CubeWalker.h"
@@ -13,7 +14,7 @@
 #include "Resources/ShaderSource.h"
 #include "Utils/MathUtils.h"
 
-Game::Game(int width, int height) 
+Game::Game(int width, int height, HeadlessConfig headless) 
     : mScreenWidth(width), mScreenHeight(height)
     , mState(GameState::SPLASH)           // Mulai dari Splash
     , mGameRunning(true)
@@ -23,8 +24,50 @@ Game::Game(int width, int height)
     , mShootTimer(0.0f)
     , mWaveBonusClaimed(false)
     , mGameLoaded(false)      // Belum load aset berat
-    , mLoadingFrameDelay(0)   // Reset counter frame
+    , mLoadingStage(0)
+    , mLoadingLongestFrame(0.0f)
+    , mStartupLogged(false)
+    , mMenuReadySeconds(0.0)
+    , mStartupTime(std::chrono::steady_clock::now())
+    , mHeadless(headless)
+    , mHeadlessTick(0)
+    , mSimAccumulator(0.0f)
+    , mRenderAlpha(1.0f)
+    , mParticles(PARTICLE_CAPACITY)
+    , mEnemyProjectiles(ENEMY_BULLET_CAPACITY)
+    , mEnemyGrid(4.0f, 4096)  // Bucket banyak biar horde ribuan gak tabrakan hash
 {
+    // Pool musuh dialokasi sekali di sini, spawn/mati di tengah game gak nyentuh heap
+    mEnemies.Reserve(ENEMY_POOL_CAPACITY);
+    mEnemies.SetFlowField(&mFlowField);
+    mEnemies.SetProjectilePool(&mEnemyProjectiles);
+    mEnemies.SetLevel(&mLevelManager);
+    mEnemyBatches.cubes.Reserve(ENEMY_POOL_CAPACITY);
+    mEnemyBatches.slimeShells.Reserve(ENEMY_POOL_CAPACITY);
+    mShadows.Reserve(ENEMY_POOL_CAPACITY + 1); // + player
+    mGemBatch.Reserve(GEM_BATCH_CAPACITY);
+    mEnemyInstancing = true;
+    mGemInstancing = true;
+    mParticleInstancing = true;
+    mParticleBillboard = false;
+
+    // 0. HEADLESS: Gak ada window, audio, texture. Cuma data simulasi.
+    if (mHeadless.enabled) {
+        SetTraceLogLevel(LOG_WARNING);
+        if (mHeadless.seed != 0) SetRandomSeed(mHeadless.seed);
+
+        mPixelMode = false;
+        mRenderScale = 1.0f;
+        mBgMusic = nullptr;
+        mPlayer.SetGodMode(mHeadless.godMode);
+
+        // Collision map tetap diload (dipakai sliding di section A)
+        mLevelManager.LoadCollisionMap("ground.png");
+
+        std::cout << "🤖 SYSTEM START: HEADLESS SIMULATION" << std::endl;
+        return;
+    }
+
     // 1. Init System Core (Cepat)
     InitWindow(mScreenWidth, mScreenHeight, "Megabonk Engine v2.0 - 25 Wave Survival");
     SetTargetFPS(60);
@@ -58,18 +101,23 @@ Game::Game(int width, int height)
     mCamera.up = (Vector3){ 0.0f, 1.0f, 0.0f };
     mCamera.fovy = 45.0f;
     mCamera.projection = CAMERA_PERSPECTIVE;
+    mPrevCamera = mCamera;
 
     // Aset berat (Model, Music, Shader) TIDAK DILOAD DISINI
-    // Pindah ke LoadGameplayContent()
+    // Worker thread langsung mulai baca/decode selama Splash, upload GPU-nya di LoadGameplayContent()
+    mAssets.BeginAsyncLoad();
     
-    std::cout << "🚀 SYSTEM START: WINDOW OPENED" << std::endl;
+    std::cout << "🚀 SYSTEM START: WINDOW OPENED (" << (int)(SecondsSinceStartup() * 1000.0) << " ms)" << std::endl;
 }
 Game::~Game() {
     // 1. Bersihkan List Object Game DULU (karena mereka punya Texture/Model)
-    mEnemies.clear();
-    mPendingEnemies.clear();
+    mEnemies.Clear();
+    mEnemyProjectiles.Clear();
     mGems.clear();
     mProjectileManager.Reset(); 
+
+    // Headless gak pernah buka window / GPU resource
+    if (mHeadless.enabled) return;
     
     // 2. Unload Texture UI
     UnloadTexture(mSplashLogo);
@@ -80,9 +128,15 @@ Game::~Game() {
     UnloadRenderTexture(mTarget);
     UnloadShader(mGroundShader);
     UnloadShader(mSlimeShader);
+    UnloadShader(mGroundInstShader);
+    UnloadShader(mSlimeInstShader);
+    UnloadMaterial(mGemMaterial);     // Ikut unload mGemShader
+    UnloadMaterial(mParticleMaterial); // Ikut unload mParticleShader
+    UnloadMesh(mParticleQuad);
     UnloadTexture(mShadowTexture);
     
     // 4. BARU TUTUP WINDOW (Ini harus paling terakhir)
+    mSfx.Unload(); // Alias dulu, baru Sound sumbernya
     mAssets.UnloadAll(); // ✅ Fix Segfault: Unload before CloseWindow
     CloseAudioDevice(); // Tambahkan ini kalau pakai InitAudioDevice
     CloseWindow();
@@ -90,17 +144,227 @@ Game::~Game() {
 void Game::Run() {
     // Loop sekarang cek mGameRunning juga
     while (!WindowShouldClose() && mGameRunning) {
-        float dt = GetFrameTime();
-        ProcessInput(dt);
-        Update(dt);
+        float frameTime = GetFrameTime();
+        mParticles.SetFrameTime(frameTime); // 📊 Budget partikel ikut turun kalau FPS drop
+
+        // 🎵 UPDATE MUSIC (Per frame, bukan per tick biar buffer gak telat)
+        if (mGameLoaded && mBgMusic != nullptr && mBgMusic->ctxData != nullptr) {
+            UpdateMusicStream(*mBgMusic);
+        }
+
+        PollInput();
+        ProcessInput(frameTime);
+
+        if (IsSimulationState()) {
+            // 🔥 FIXED TIMESTEP: Gameplay selalu maju SIM_FIXED_DT per tick,
+            // frame lama (stall loading / spawn boss) dibayar pakai beberapa tick.
+            mSimAccumulator += frameTime;
+
+            // Anti spiral of death: buang sisa waktu yang melebihi batas catch-up
+            float maxBacklog = SIM_FIXED_DT * SIM_MAX_CATCHUP_STEPS;
+            if (mSimAccumulator > maxBacklog) mSimAccumulator = maxBacklog;
+
+            while (mSimAccumulator >= SIM_FIXED_DT && IsSimulationState()) {
+                SavePreviousState();
+                Update(SIM_FIXED_DT);
+                mInput.ClearEdges(); // Edge event cuma dipakai 1 tick
+                mSimAccumulator -= SIM_FIXED_DT;
+            }
+
+            mRenderAlpha = mSimAccumulator / SIM_FIXED_DT;
+        } else {
+            // Menu, Splash, Loading, Pause: cukup variable dt biasa
+            mSimAccumulator = 0.0f;
+            mRenderAlpha = 1.0f;
+            Update(frameTime);
+        }
+
         Draw();
     }
 }
+void Game::RunHeadless() {
+    ResetGame(); // Langsung PLAYING (Survival)
+    if (mHeadless.weapon >= 0 && mHeadless.weapon <= 3) {
+        mPlayer.SwitchWeapon((WeaponType)mHeadless.weapon);
+    }
+
+    std::cout << "🤖 HEADLESS RUN: target wave " << mHeadless.targetWave
+              << ", max ticks " << mHeadless.maxTicks << std::endl;
+
+    // GetTime() butuh window (GLFW), jadi pakai steady_clock
+    auto startTime = std::chrono::steady_clock::now();
+    mHeadlessTick = 0;
+    int peakEnemies = 0;
+
+    // Alokasi heap EnemyStore per wave (harus 0 setelah pool kepakai penuh)
+    int allocWave = mWaveManager.GetCurrentWave();
+    int allocAtWaveStart = mEnemies.AllocStats().Total();
+
+    long aiFull = 0, aiReduced = 0, aiDeferred = 0;
+
+    while (mState == GameState::PLAYING) {
+        if (mHeadless.maxTicks > 0 && mHeadlessTick >= mHeadless.maxTicks) break;
+
+        // Wave target beres -> stop
+        if (mWaveManager.GetCurrentWave() > mHeadless.targetWave) break;
+        if (mWaveManager.GetCurrentWave() == mHeadless.targetWave &&
+            mWaveManager.GetState() == WaveState::COMPLETED) break;
+
+        mInput = BuildScriptedInput();
+        SavePreviousState();
+        Update(SIM_FIXED_DT);
+        mInput.ClearEdges();
+
+        peakEnemies = std::max(peakEnemies, mEnemies.Count());
+        aiFull += mEnemies.AiStats().fullRate;
+        aiReduced += mEnemies.AiStats().reduced;
+        aiDeferred += mEnemies.AiStats().deferred;
+        mHeadlessTick++;
+
+        if (mWaveManager.GetCurrentWave() != allocWave) {
+            std::cout << "📦 ENEMY ALLOCS wave " << allocWave << ": "
+                      << (mEnemies.AllocStats().Total() - allocAtWaveStart) << std::endl;
+            allocWave = mWaveManager.GetCurrentWave();
+            allocAtWaveStart = mEnemies.AllocStats().Total();
+        }
+    }
+
+    const EnemyAllocStats& allocs = mEnemies.AllocStats();
+
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    double simSeconds = mHeadlessTick * (double)SIM_FIXED_DT;
+    double msPerTick = (mHeadlessTick > 0) ? (elapsed * 1000.0 / mHeadlessTick) : 0.0;
+
+    const char* result = "STOPPED";
+    if (mState == GameState::GAME_OVER) result = "GAME_OVER";
+    else if (mState == GameState::VICTORY) result = "VICTORY";
+
+    std::cout << "🤖 HEADLESS DONE: " << result
+              << " | ticks " << mHeadlessTick
+              << " | sim " << simSeconds << " s"
+              << " | wall " << elapsed << " s"
+              << " | " << msPerTick << " ms/tick"
+              << " | wave " << mWaveManager.GetCurrentWave()
+              << " | peak enemies " << peakEnemies
+              << " | player lvl " << mPlayer.GetLevel() << std::endl;
+    std::cout << "📦 ENEMY ALLOCS total " << allocs.Total()
+              << " (columns " << allocs.columnGrowths
+              << ", lists " << allocs.listGrowths << ")" << std::endl;
+    std::cout << "🎯 ENEMY BULLETS peak " << mEnemyProjectiles.Peak()
+              << " / " << mEnemyProjectiles.Capacity()
+              << " | dropped " << mEnemyProjectiles.Dropped() << std::endl;
+    // ✨ Budget partikel per efek (requested = diminta pemanggil, dropped = di-scale budget / pool penuh)
+    for (int i = 0; i < (int)ParticleEffect::COUNT; i++) {
+        ParticleEffect effect = (ParticleEffect)i;
+        const ParticleEffectStats& stats = mParticles.GetEffectStats(effect);
+        if (stats.requested == 0) continue;
+        std::cout << "✨ PARTICLES " << ParticleSystem::GetEffectName(effect)
+                  << " | emitted " << stats.emitted
+                  << " | dropped " << stats.Dropped() << std::endl;
+    }
+    // 🔊 Voice pool SFX (coalesced = digabung di tick yang sama, dropped = semua voice sibuk)
+    for (int i = 0; i < (int)SoundEffect::COUNT; i++) {
+        SoundEffect effect = (SoundEffect)i;
+        const SoundEffectStats& stats = mSfx.GetStats(effect);
+        if (stats.triggers == 0) continue;
+        std::cout << "🔊 SFX " << SoundVoicePool::GetEffectName(effect)
+                  << " | triggers " << stats.triggers
+                  << " | coalesced " << stats.coalesced
+                  << " | played " << stats.played
+                  << " | dropped " << stats.dropped
+                  << " | peak voices " << stats.peakVoices << std::endl;
+    }
+
+    double ticks = (mHeadlessTick > 0) ? (double)mHeadlessTick : 1.0;
+    std::cout << "🧠 AI LOD " << (mEnemies.AiLod().enabled ? "ON" : "OFF")
+              << " (budget " << mEnemies.AiLod().updateBudget << ")"
+              << " | per tick: full " << aiFull / ticks
+              << ", reduced " << aiReduced / ticks
+              << ", deferred " << aiDeferred / ticks << std::endl;
+
+#if MEGABONK_PROFILER
+    mProfiler.PrintTable();
+    if (!mHeadless.profileCsv.empty()) mProfiler.DumpCSV(mHeadless.profileCsv.c_str());
+#endif
+}
+void Game::PollInput() {
+    // 1. State tahan (held): ditimpa tiap frame
+    mInput.moveDir = { 0, 0, 0 };
+    if (IsKeyDown(KEY_W)) mInput.moveDir.z -= 1;
+    if (IsKeyDown(KEY_S)) mInput.moveDir.z += 1;
+    if (IsKeyDown(KEY_A)) mInput.moveDir.x -= 1;
+    if (IsKeyDown(KEY_D)) mInput.moveDir.x += 1;
+
+    mInput.fireHeld = IsMouseButtonDown(MOUSE_BUTTON_LEFT);
+
+    // Raycast mouse ke lantai (Y=0), fallback ke posisi player
+    mInput.aimTarget = mPlayer.GetPosition();
+    Ray ray = GetScreenToWorldRay(GetMousePosition(), mCamera);
+    if (ray.direction.y != 0) {
+        float t = -ray.position.y / ray.direction.y;
+        if (t >= 0) mInput.aimTarget = Vector3Add(ray.position, Vector3Scale(ray.direction, t));
+    }
+
+    // 2. Edge event: di-OR, biar gak hilang kalau frame ini gak ada tick simulasi
+    if (IsMouseButtonReleased(MOUSE_BUTTON_RIGHT)) mInput.dashReleased = true;
+
+    if (IsKeyPressed(KEY_ONE)) mInput.weaponSelect = (int)WeaponType::PISTOL;
+    if (IsKeyPressed(KEY_TWO)) mInput.weaponSelect = (int)WeaponType::SHOTGUN;
+    if (IsKeyPressed(KEY_THREE)) mInput.weaponSelect = (int)WeaponType::MINIGUN;
+    if (IsKeyPressed(KEY_FOUR)) mInput.weaponSelect = (int)WeaponType::BAZOOKA;
+
+    float scroll = GetMouseWheelMove();
+    if (scroll > 0) mInput.weaponScroll = 1;
+    else if (scroll < 0) mInput.weaponScroll = -1;
+}
+PlayerInput Game::BuildScriptedInput() {
+    PlayerInput in;
+    Vector3 playerPos = mPlayer.GetPosition();
+
+    // Orbit di sekitar tengah map (radius ~10m) biar horde ngikutin & player gak kabur keluar map
+    const float orbitRadius = 10.0f;
+    float distFromCenter = sqrtf(playerPos.x * playerPos.x + playerPos.z * playerPos.z);
+    if (distFromCenter < 0.1f) {
+        in.moveDir = { 1, 0, 0 };
+    } else {
+        Vector3 radial = { -playerPos.x / distFromCenter, 0, -playerPos.z / distFromCenter };
+        Vector3 tangent = { -radial.z, 0, radial.x };
+        float pull = (distFromCenter - orbitRadius) / orbitRadius * 2.0f;
+        in.moveDir = Vector3Add(tangent, Vector3Scale(radial, pull));
+    }
+
+    // Bidik musuh terdekat, kalau gak ada bidik ke depan
+    in.aimTarget = Vector3Add(playerPos, in.moveDir);
+    float bestDist = 1e9f;
+    for (int i = 0; i < mEnemies.Count(); i++) {
+        if (!mEnemies.IsActive(i)) continue;
+        float d = Vector3Distance(playerPos, mEnemies.position[i]);
+        if (d < bestDist) {
+            bestDist = d;
+            in.aimTarget = mEnemies.position[i];
+        }
+    }
+
+    in.fireHeld = true;
+    in.dashReleased = (mHeadlessTick % (long)(SIM_TICK_RATE * 2) == 0); // Dash tiap 2 detik
+    return in;
+}
+bool Game::IsSimulationState() const {
+    return mState == GameState::PLAYING || mState == GameState::STORY_MODE;
+}
+void Game::SavePreviousState() {
+    mPrevCamera = mCamera;
+    mPlayer.SavePreviousState();
+    mEnemies.SavePreviousState();
+    mEnemyProjectiles.SavePreviousState();
+    mProjectileManager.SavePreviousState();
+    for (auto& g : mGems) g.prevPosition = g.position;
+}
 void Game::ResetGame() {
     mState = GameState::PLAYING;
     mPlayer.Reset();
-    mEnemies.clear();
-    mPendingEnemies.clear();
+    mEnemies.Clear();
+    mEnemyProjectiles.Clear();
     mGems.clear();
     mParticles.Reset();
     mWaveManager.Reset();
@@ -110,6 +374,22 @@ void Game::ResetGame() {
     mScreenShakeIntensity = 0.0f;
 }
 void Game::ProcessInput(float dt) {
+#if MEGABONK_PROFILER
+    // ⏱️ Profiler hotkey (semua state)
+    if (IsKeyPressed(KEY_F3)) mProfiler.ToggleOverlay();
+    if (IsKeyPressed(KEY_F4)) mProfiler.DumpCSV(TextFormat("profile_%.0f.csv", GetTime()));
+#endif
+    // 🧊 Instancing musuh on/off (buat bandingin draw call)
+    if (IsKeyPressed(KEY_F6)) {
+        mEnemyInstancing = !mEnemyInstancing;
+        std::cout << "🧊 ENEMY INSTANCING: " << (mEnemyInstancing ? "ON" : "OFF") << std::endl;
+    }
+    // ✨ Partikel kubus / billboard
+    if (IsKeyPressed(KEY_F7) && mParticleInstancing) {
+        mParticleBillboard = !mParticleBillboard;
+        std::cout << "✨ PARTICLE MODE: " << (mParticleBillboard ? "BILLBOARD" : "CUBE") << std::endl;
+    }
+
     // -----------------------------------------------------------------------
     // 1. STATE: LOADING (Blokir semua input)
     // -----------------------------------------------------------------------
@@ -176,8 +456,8 @@ void Game::ProcessInput(float dt) {
         // CHEAT CODE: Shift + L + J (Skip Wave)
         if (IsKeyDown(KEY_LEFT_SHIFT) && IsKeyDown(KEY_L) && IsKeyPressed(KEY_J)) {
             std::cout << "⏩ CHEAT ACTIVATED: SKIPPING WAVE!" << std::endl;
-            mEnemies.clear();
-            mPendingEnemies.clear();
+            mEnemies.Clear();
+            mEnemyProjectiles.Clear();
             mWaveManager.ForceSkipWave();
         }
         return;
@@ -209,11 +489,6 @@ void Game::ProcessInput(float dt) {
     }
 }
 void Game::Update(float dt) {
-    // 🎵 UPDATE MUSIC (Hanya jika aset sudah dimuat)
-    if (mGameLoaded && mBgMusic != nullptr && mBgMusic->ctxData != nullptr) {
-        UpdateMusicStream(*mBgMusic);
-    }
-
     // ==============================================================================
     // 1. SPLASH SCREEN (TOTAL 5 DETIK: Fade In -> Wait -> Fade Out)
     // ==============================================================================
@@ -237,19 +512,17 @@ void Game::Update(float dt) {
     // ==============================================================================
     if (mState == GameState::LOADING) {
         
-        // A. FASE BELUM LOAD (Animasi Fade In dulu, baru Load Berat)
+        // A. FASE BELUM LOAD (Fade In UI sambil upload aset sedikit-sedikit tiap frame)
         if (!mGameLoaded) {
             mLoadingTimer += dt; // Pakai timer ini untuk animasi Fade In teks/bar
-            
-            // Tunggu 0.5 detik agar UI Loading terlihat muncul pelan-pelan
-            if (mLoadingTimer > 0.5f) {
-                mLoadingFrameDelay++;
-                
-                // Tunggu 5 frame lagi untuk memastikan GPU menggambar UI ke layar
-                if (mLoadingFrameDelay > 5) {
-                    LoadGameplayContent(); // ⚠️ PROSES BERAT (FREEZE) DI SINI
-                    mGameLoaded = true;    // Tandai selesai
-                }
+            if (dt > mLoadingLongestFrame) mLoadingLongestFrame = dt;
+
+            // Gak ada freeze: worker decode di belakang, di sini cuma upload dalam budget
+            if (LoadGameplayContent()) {
+                mGameLoaded = true; // Tandai selesai
+                // Angka startup yang beneran: menu udah bisa dibuka dari sini (sisanya nunggu player)
+                mMenuReadySeconds = SecondsSinceStartup();
+                std::cout << "⏱️ STARTUP-TO-MENU: " << (int)(mMenuReadySeconds * 1000.0) << " ms (menu siap)" << std::endl;
             }
             return; // Jangan lanjut ke logic lain saat fase ini
         }
@@ -260,6 +533,12 @@ void Game::Update(float dt) {
             if (mAssets.IsSoundReady("confirm")) PlaySound(mAssets.GetSound("confirm"));
             
             mState = GameState::MAIN_MENU;
+            if (!mStartupLogged) {
+                mStartupLogged = true;
+                double opened = SecondsSinceStartup();
+                std::cout << "⏱️ MENU OPENED: " << (int)(opened * 1000.0) << " ms (termasuk nunggu SPACE "
+                          << (int)((opened - mMenuReadySeconds) * 1000.0) << " ms)" << std::endl;
+            }
         }
         return;
     }
@@ -285,32 +564,33 @@ void Game::Update(float dt) {
     // 5. 🔥 GAMEPLAY LOGIC (Hanya jalan saat State == PLAYING)
     // ==============================================================================
 
+    PROFILE_SCOPE(mProfiler, ProfPhase::UPDATE_TOTAL);
+    PROFILE_LAP_BEGIN(mProfiler, lap);
+    mSfx.BeginTick(); // Trigger SFX yang sama di tick ini digabung jadi 1
+
     // --- A. PLAYER MOVEMENT & MAP COLLISION (SLIDING LOGIC) ---
+    PROFILE_LAP(lap, ProfPhase::UPDATE_A_MOVEMENT);
     
     float playerRadius = 0.5f;
     Vector3 oldPos = mPlayer.GetPosition();
     
     // 1. Prediksi Posisi Berikutnya (Tanpa Gerak Dulu)
-    Vector3 desiredPos = mPlayer.GetFuturePosition(dt);
+    Vector3 desiredPos = mPlayer.GetFuturePosition(dt, mInput);
     
-    // 2. Cek Tabrakan di Posisi Target
-    if (mLevelManager.IsPixelCollision(desiredPos, playerRadius)) {
+    // 2. Cek Tabrakan di Posisi Target (📐 SDF: radius player beneran dihitung)
+    if (mLevelManager.IsCircleBlocked(desiredPos, playerRadius)) {
         
-        // 🔥 SLIDING LOGIC: Coba gerak per sumbu
-        Vector3 slideX = { desiredPos.x, oldPos.y, oldPos.z };
-        Vector3 slideZ = { oldPos.x, oldPos.y, desiredPos.z };
-        
-        // Cek Sumbu X aman?
-        if (!mLevelManager.IsPixelCollision(slideX, playerRadius)) {
-             mPlayer.SetPosition(slideX);
-        }
-        // Cek Sumbu Z aman?
-        else if (!mLevelManager.IsPixelCollision(slideZ, playerRadius)) {
-             mPlayer.SetPosition(slideZ);
-        }
-        else {
-             // Stuck total, diam di tempat
-             // mPlayer.SetPosition(oldPos); // Tidak perlu set, karena belum di-set
+        // 🔥 SLIDING LOGIC: Dorong keluar tembok sepanjang normal-nya, jadi gerak yang nabrak
+        // miring tetap nyisa komponen sejajar tembok (gak cuma per sumbu X / Z)
+        Vector3 slidPos = mLevelManager.ResolveCircle(desiredPos, playerRadius);
+
+        // Tolak kalau masih nyangkut (celah lebih sempit dari player) atau kedorong tembus
+        // ke sisi lain tembok tipis (dash) -> diam di tempat
+        float step = Vector3Distance(oldPos, desiredPos);
+        bool stillBlocked = mLevelManager.IsCircleBlocked(slidPos, playerRadius * 0.95f);
+        bool tunneled = Vector3Distance(desiredPos, slidPos) > playerRadius + step;
+        if (!stillBlocked && !tunneled) {
+             mPlayer.SetPosition(slidPos);
         }
         
     } else {
@@ -319,7 +599,7 @@ void Game::Update(float dt) {
     }
     
     // PENTING: Update rotasi player & animasi (tanpa ubah posisi lagi)
-    mPlayer.UpdateRotationOnly(dt); 
+    mPlayer.UpdateRotationOnly(dt, mInput); 
 
     // 3. Keep old CheckWallCollision for backward compatibility (optional)
     // if (mLevelManager.CheckWallCollision(mPlayer.GetPosition(), 0.5f)) {
@@ -327,30 +607,27 @@ void Game::Update(float dt) {
     // }
 
     // --- B. MANAGERS UPDATE ---
-    mProjectileManager.Update(dt, mAssets, mParticles);
+    PROFILE_LAP(lap, ProfPhase::UPDATE_B_MANAGERS);
+    mProjectileManager.Update(dt, mSfx, mParticles);
     mParticles.Update(dt);
     mItemManager.Update(dt);
 
     // --- C. SHOOTING & DASH INPUT ---
-    // Ubah pengecekan right click jadi IsMouseButtonReleased
-    if (IsMouseButtonDown(MOUSE_BUTTON_LEFT) || IsMouseButtonReleased(MOUSE_BUTTON_RIGHT)) {
-        Ray ray = GetScreenToWorldRay(GetMousePosition(), mCamera);
-        float t = (0.0f - ray.position.y) / ray.direction.y;
-        Vector3 targetOnGround = Vector3Add(ray.position, Vector3Scale(ray.direction, t));
-        
-        if (IsMouseButtonDown(MOUSE_BUTTON_LEFT)) {
-            mPlayer.TryShoot(targetOnGround, mProjectileManager, dt);
-        }
-        
-        // 🔥 Trigger dash SAAT TOMBOL DILEPAS
-        if (IsMouseButtonReleased(MOUSE_BUTTON_RIGHT)) {
-            mPlayer.TryDash(targetOnGround);
-        }
+    PROFILE_LAP(lap, ProfPhase::UPDATE_C_INPUT);
+    // Input udah di-snapshot (PollInput / BuildScriptedInput), simulasi gak baca mouse langsung
+    if (mInput.fireHeld) {
+        mPlayer.TryShoot(mInput.aimTarget, mProjectileManager, dt);
+    }
+    
+    // 🔥 Trigger dash SAAT TOMBOL DILEPAS
+    if (mInput.dashReleased) {
+        mPlayer.TryDash(mInput.aimTarget);
     }
 
     Vector3 playerPos = mPlayer.GetPosition();
 
     // --- D. CAMERA LOGIC ---
+    PROFILE_LAP(lap, ProfPhase::UPDATE_D_CAMERA);
     // Screen Shake Decay
     if (mScreenShakeIntensity > 0) {
         mScreenShakeIntensity -= 5.0f * dt;
@@ -364,12 +641,7 @@ void Game::Update(float dt) {
     };
 
     // Camera Follow & Peek
-    Vector3 mouseWorldPos = playerPos;
-    Ray rayCam = GetScreenToWorldRay(GetMousePosition(), mCamera);
-    if (rayCam.direction.y != 0) {
-        float t = -rayCam.position.y / rayCam.direction.y;
-        if (t >= 0) mouseWorldPos = Vector3Add(rayCam.position, Vector3Scale(rayCam.direction, t));
-    }
+    Vector3 mouseWorldPos = mInput.aimTarget;
 
     Vector3 lookOffset = Vector3Subtract(mouseWorldPos, playerPos);
     float maxPeekDist = 12.0f;
@@ -385,13 +657,24 @@ void Game::Update(float dt) {
     mCamera.position = Vector3Add(finalTarget, (Vector3){ 0.0f, 35.0f, 25.0f });
     mCamera.target = finalTarget;
 
+    // Kerucut pandang buat AI LOD (pakai sudut diagonal layar, pojok layar tetap dihitung kelihatan)
+    if (!mHeadless.enabled) {
+        float tanHalfFov = tanf(mCamera.fovy * 0.5f * DEG2RAD);
+        float aspect = (float)mScreenWidth / (float)mScreenHeight;
+        float tanDiag = tanHalfFov * sqrtf(1.0f + aspect * aspect);
+        mEnemies.SetViewCone(mCamera.position, Vector3Subtract(mCamera.target, mCamera.position),
+                             1.0f / sqrtf(1.0f + tanDiag * tanDiag));
+    }
+
     // --- E. WAVE MANAGER ---
+    PROFILE_LAP(lap, ProfPhase::UPDATE_E_WAVES);
     if (mState == GameState::PLAYING) {
-        mWaveManager.Update(dt, mPlayer.GetLevel(), (int)mEnemies.size());
+        mWaveManager.Update(dt, mPlayer.GetLevel(), mEnemies.Count());
 
         if (mWaveManager.ShouldSpawn()) {
             EnemySpawnEntry entry = mWaveManager.GetNextSpawn();
             SpawnEnemy(entry, {0, 0, 0}); // 0,0,0 trigger random position logic di SpawnEnemy
+            mEnemies.CommitPending();      // Spawn wave langsung ikut update tick ini
             mWaveManager.ConsumeSpawnSignal();
         }
     }
@@ -401,7 +684,7 @@ void Game::Update(float dt) {
         if (!mWaveBonusClaimed) {
             int bonusXP = mWaveManager.GetWaveBonusXP();
             mPlayer.AddXP(bonusXP);
-            mParticles.SpawnExplosion(playerPos, GOLD, 50);
+            mParticles.SpawnExplosion(ParticleEffect::WAVE_CLEAR, playerPos, GOLD, 50);
             mWaveBonusClaimed = true;
             
             if (mWaveManager.GetCurrentWave() >= 25) {
@@ -414,81 +697,88 @@ void Game::Update(float dt) {
     }
 
     // --- F. ENEMY LOGIC & PLAYER COLLISION ---
-    for (auto& e : mEnemies) {
-        if (!e->IsActive()) continue;
+    PROFILE_LAP(lap, ProfPhase::UPDATE_F_ENEMY_LOGIC);
+    // Behavior per tipe jalan batch (CubeWalker, Charger, Slime, dst), lalu interaksi per row
+    mFlowField.Update(mLevelManager, playerPos); // Wall-aware chase, 1 BFS dibagi semua musuh
+    mEnemies.UpdateBehaviors(dt, playerPos);
 
-        e->Update(dt, playerPos);
+    for (int i = 0; i < mEnemies.Count(); i++) {
+        if (!mEnemies.IsActive(i)) continue;
 
         // Boss Minion Spawn
-        BossEnemy* boss = dynamic_cast<BossEnemy*>(e.get());
-        if (boss && boss->ShouldSpawnMinion()) {
-            Vector3 spawnPos = boss->GetPosition();
-            spawnPos.x += GetRandomFloat(-3, 3);
-            spawnPos.z += GetRandomFloat(-3, 3);
-            mPendingEnemies.push_back(std::make_unique<CubeWalker>(1, spawnPos));
-            boss->ConsumeSpawnSignal();
+        if (mEnemies.HasCapability(i, ENEMY_CAP_SPAWNS_MINIONS)) {
+            BossState* boss = BossEnemy::FindState(mEnemies, i);
+            if (boss && boss->shouldSpawnMinion) {
+                Vector3 spawnPos = mEnemies.position[i];
+                spawnPos.x += GetRandomFloat(-3, 3);
+                spawnPos.z += GetRandomFloat(-3, 3);
+                mEnemies.Spawn(EnemyType::CUBE_WALKER, 1, spawnPos); // Pending, aktif di section K
+                boss->shouldSpawnMinion = false;
+            }
         }
 
-        // Tabrakan Musuh ke Player
-        if (Vector3Distance(playerPos, e->GetPosition()) < (e->GetRadius() + 0.5f)) {
+        // Tabrakan Musuh ke Player (jarak kuadrat, hemat sqrt per musuh)
+        float touchDist = mEnemies.radius[i] + 0.5f;
+        if (Vector3DistanceSqr(playerPos, mEnemies.position[i]) < touchDist * touchDist) {
             mPlayer.TakeDamage(20.0f * dt);
             mScreenShakeIntensity = 0.4f;
 
             if (mPlayer.IsDead()) {
                 mState = GameState::GAME_OVER;
-                mParticles.SpawnExplosion(playerPos, WHITE, 50); // Bulu Ayam (White Feathers)
+                mParticles.SpawnExplosion(ParticleEffect::PLAYER_DEATH, playerPos, WHITE, 50); // Bulu Ayam (White Feathers)
             }
         }
 
         // Exploder Logic
-        ExploderEnemy* exploder = dynamic_cast<ExploderEnemy*>(e.get());
-        if (exploder && exploder->ShouldExplode(playerPos)) {
-            float dist = Vector3Distance(playerPos, exploder->GetPosition());
-            if (dist < exploder->GetExplosionRadius()) {
-                mPlayer.TakeDamage(exploder->GetExplosionDamage());
+        if (!mEnemies.HasCapability(i, ENEMY_CAP_EXPLODES)) continue;
+        if (ExploderEnemy::ShouldExplode(mEnemies, i)) {
+            Vector3 exploderPos = mEnemies.position[i];
+            float dist = Vector3Distance(playerPos, exploderPos);
+            if (dist < mEnemies.attackRange[i]) {
+                mPlayer.TakeDamage(mEnemies.attackPower[i]);
                 mScreenShakeIntensity = 1.0f;
             }
-            mParticles.SpawnExplosion(exploder->GetPosition(), GREEN, 80);
-            exploder->TakeDamage(9999); // Mati instan
+            mParticles.SpawnExplosion(ParticleEffect::EXPLODER, exploderPos, GREEN, 80);
+            mEnemies.TakeDamage(i, 9999); // Mati instan
         }
     }
 
+    // Crowd separation: 1 pass batch buat semua tipe (objek grid-nya dipinjem, isinya dibangun ulang di H)
+    PROFILE_LAP(lap, ProfPhase::UPDATE_F_SEPARATION);
+    mEnemies.ApplySeparation(mEnemyGrid, dt);
+
     // --- G. ENEMY PROJECTILE COLLISION ---
-    for (auto& e : mEnemies) {
-        if (!e->IsActive()) continue;
-
-        // Shooter Bullets
-        ShooterEnemy* shooter = dynamic_cast<ShooterEnemy*>(e.get());
-        if (shooter) {
-            auto& bullets = shooter->GetBullets();
-            for (auto& b : bullets) {
-                if (!b.active) continue;
-                if (Vector3Distance(playerPos, b.position) < (b.radius + 0.5f)) {
-                    mPlayer.TakeDamage(b.damage);
-                    b.active = false;
-                    mParticles.SpawnExplosion(b.position, RED, 10);
-                    mScreenShakeIntensity = 0.3f;
-                }
-            }
-        }
-        // Boss Projectiles
-        BossEnemy* boss = dynamic_cast<BossEnemy*>(e.get());
-        if (boss) {
-            auto& projectiles = boss->GetProjectiles();
-            for (auto& p : projectiles) {
-                if (!p.active) continue;
-                if (Vector3Distance(playerPos, p.position) < (p.radius + 0.5f)) {
-                    mPlayer.TakeDamage(p.damage);
-                    p.active = false;
-                    mParticles.SpawnExplosion(p.position, ORANGE, 15);
-                    mScreenShakeIntensity = 0.5f;
-                }
-            }
+    PROFILE_LAP(lap, ProfPhase::UPDATE_G_ENEMY_PROJ);
+    // Semua peluru Shooter & Boss di 1 pool: gerak 1 pass, lalu cek ke player 1 loop
+    mEnemyProjectiles.Update(dt);
+    for (int i = 0; i < mEnemyProjectiles.Count(); ) {
+        EnemyBullet& b = mEnemyProjectiles[i];
+        float hitDist = b.radius + 0.5f;
+        if (Vector3DistanceSqr(playerPos, b.position) < hitDist * hitDist) {
+            mPlayer.TakeDamage(b.damage);
+            mParticles.SpawnExplosion(ParticleEffect::PLAYER_HIT, b.position, b.fromBoss ? ORANGE : RED, b.fromBoss ? 15 : 10);
+            mScreenShakeIntensity = b.fromBoss ? 0.5f : 0.3f;
+            mEnemyProjectiles.Kill(i); // Swap-remove: slot i sekarang peluru lain, jangan i++
+            continue;
         }
+        i++;
     }
 
     // --- H. PLAYER PROJECTILE COLLISION ---
+    PROFILE_LAP(lap, ProfPhase::UPDATE_H_PLAYER_PROJ);
     auto& projectiles = mProjectileManager.GetProjectiles();
+
+    // Grid musuh dibangun lagi di sini, beda sama grid titik separation (sengaja 2x Build):
+    // - posisi udah geser kena dorongan separation + clamp tembok abis grid itu dibangun
+    // - di sini musuh masuk ke semua cell radius-nya, jadi query peluru kecil cukup 1-4 cell & urut index.
+    //   Numpang grid titik = query harus digedein radius musuh terbesar (boss 5) + dorongan -> kandidat
+    //   jauh lebih banyak per peluru, lebih mahal dari 1 counting sort O(n) ini
+    mEnemyGrid.Clear();
+    for (int i = 0; i < mEnemies.Count() && !projectiles.empty(); i++) {
+        if (mEnemies.IsActive(i)) mEnemyGrid.Insert(i, mEnemies.position[i], mEnemies.radius[i]);
+    }
+    mEnemyGrid.Build();
+
     for (auto& b : projectiles) {
         if (!b.active) continue;
         
@@ -497,47 +787,44 @@ void Game::Update(float dt) {
         // Parameter: Posisi Peluru, Radius Peluru, Damage ke Tembok (misal 10)
         if (mLevelManager.CheckBreakableCollision(b.position, b.radius, 10.0f)) {
             b.active = false; // Peluru hancur
-            mParticles.SpawnExplosion(b.position, RED, 15); // Efek pecahan tembok
+            mParticles.SpawnExplosion(ParticleEffect::WALL_CHIP, b.position, RED, 15); // Efek pecahan tembok
             
-            // Efek Suara (Opsional, pakai sound crack jika ada)
-            if (mAssets.IsSoundReady("crack")) {
-                 Sound& sfx = mAssets.GetSound("crack");
-                 SetSoundPitch(sfx, GetRandomFloat(0.7f, 0.9f)); // Suara lebih berat buat tembok
-                 PlaySound(sfx);
-            }
+            // Efek Suara (pitch berat + batas voice diatur SoundVoicePool)
+            mSfx.Play(SoundEffect::WALL_HIT);
             
             continue; // Lanjut ke peluru berikutnya, jangan cek musuh lagi
         }
 
-        // [LAMA] 2. Cek Tabrakan dengan Musuh
-        for (auto& e : mEnemies) {
-            if (!e->IsActive()) continue;
+        // 2. Cek Tabrakan dengan Musuh (kandidat dari grid, urut index = hasil sama kayak brute force)
+        mEnemyGrid.Query(b.position, b.radius, mGridCandidates);
+        for (int row : mGridCandidates) {
+            if (!mEnemies.IsActive(row)) continue;
 
-            if (CheckCollisionSpheres(b.position, b.radius, e->GetPosition(), e->GetRadius())) {
-                e->TakeDamage(b.damage); 
+            if (CheckCollisionSpheres(b.position, b.radius, mEnemies.position[row], mEnemies.radius[row])) {
+                mEnemies.TakeDamage(row, b.damage); 
                 b.active = false;
-                mParticles.SpawnExplosion(b.position, YELLOW, 5);
+                mParticles.SpawnExplosion(ParticleEffect::ENEMY_HIT, b.position, YELLOW, 5);
                 
-                if (mAssets.IsSoundReady("crack")) {
-                    Sound& sfx = mAssets.GetSound("crack");
-                    SetSoundPitch(sfx, GetRandomFloat(1.8f, 2.2f)); 
-                    PlaySound(sfx);
-                }
+                mSfx.Play(SoundEffect::BULLET_HIT);
 
                 // Enemy Death Logic
-                if (!e->IsActive()) {
-                    Color color = (e->GetTier() == 1) ? RED : ((e->GetTier() == 2) ? BLUE : GOLD);
-                    mParticles.SpawnExplosion(e->GetPosition(), color, 20);
+                if (!mEnemies.IsActive(row)) {
+                    // Copy dulu: Spawn() di bawah bisa realokasi kolom store
+                    Vector3 enemyPos = mEnemies.position[row];
+                    int tier = mEnemies.tier[row];
+
+                    Color color = (tier == 1) ? RED : ((tier == 2) ? BLUE : GOLD);
+                    mParticles.SpawnExplosion(ParticleEffect::ENEMY_DEATH, enemyPos, color, 20);
                     mScreenShakeIntensity = 0.3f;
 
                     // Spawn XP Orbs
-                    int totalXP = e->GetXPReward();
+                    int totalXP = mEnemies.xpReward[row];
                     int orbCount = GetRandomValue(3, 8);
                     int xpPerOrb = totalXP / orbCount;
                     int remainder = totalXP % orbCount;
 
                     for(int i = 0; i < orbCount; i++) {
-                        Vector3 spawnPos = e->GetPosition();
+                        Vector3 spawnPos = enemyPos;
                         spawnPos.y += 0.5f; 
                         
                         Vector3 randomVel = {
@@ -546,21 +833,20 @@ void Game::Update(float dt) {
                             GetRandomFloat(-6.0f, 6.0f)
                         };
 
-                        mGems.push_back({spawnPos, (float)xpPerOrb + (i==0?remainder:0), true, randomVel});
+                        mGems.push_back({spawnPos, (float)xpPerOrb + (i==0?remainder:0), true, randomVel, spawnPos});
                     }
 
                     // Loot Drop
-                    SlimeJumper* slime = dynamic_cast<SlimeJumper*>(e.get());
-                    if (slime && slime->HasLoot()) {
-                        mItemManager.SpawnItem(e->GetPosition(), slime->GetLootType(), slime->GetWeaponDropTier());
+                    if (mEnemies.HasCapability(row, ENEMY_CAP_DROPS_LOOT) && SlimeJumper::HasLoot(mEnemies, row)) {
+                        mItemManager.SpawnItem(enemyPos, SlimeJumper::GetLootType(mEnemies, row), SlimeJumper::GetWeaponDropTier(mEnemies, row));
                     }
                     
-                    // Split Logic
-                    if (e->CanSplit()) {
+                    // Split Logic (anak masuk pending, aktif di section K)
+                    if (mEnemies.canSplit[row]) {
                         int childrenCount = GetRandomValue(2, 3);
                         for(int i = 0; i < childrenCount; i++) {
                             Vector3 offset = { GetRandomFloat(-1,1), 0, GetRandomFloat(-1,1) };
-                            mPendingEnemies.push_back(std::make_unique<CubeWalker>(1, Vector3Add(e->GetPosition(), offset)));
+                            mEnemies.Spawn(EnemyType::CUBE_WALKER, 1, Vector3Add(enemyPos, offset));
                         }
                     }
                 }
@@ -570,6 +856,7 @@ void Game::Update(float dt) {
     }
 
     // --- I. XP GEM PHYSICS & MAGNET ---
+    PROFILE_LAP(lap, ProfPhase::UPDATE_I_GEMS);
     float magnetRadius = mPlayer.HasMagnetBuff() ? 10.0f : 5.0f;
     
     for (auto& g : mGems) {
@@ -606,29 +893,26 @@ void Game::Update(float dt) {
     }
 
     // --- J. ITEM PICKUP ---
+    PROFILE_LAP(lap, ProfPhase::UPDATE_J_ITEMS);
     int weaponTier = -1;
     ItemType picked = mItemManager.CheckPickup(playerPos, 1.5f, weaponTier);
 
     if (picked == ItemType::MAGNET) {
         mPlayer.ActivateMagnetBuff(10.0f);
-        mParticles.SpawnExplosion(playerPos, BLUE, 30);
+        mParticles.SpawnExplosion(ParticleEffect::PICKUP, playerPos, BLUE, 30);
     }
     else if (picked == ItemType::HEALTH_PACK) {
         mPlayer.Heal(50.0f);
-        mParticles.SpawnExplosion(playerPos, RED, 20);
+        mParticles.SpawnExplosion(ParticleEffect::PICKUP, playerPos, RED, 20);
     }
     else if (picked == ItemType::WEAPON_DROP) {
         mPlayer.SwitchWeapon((WeaponType)weaponTier);
-        mParticles.SpawnExplosion(playerPos, YELLOW, 40);
+        mParticles.SpawnExplosion(ParticleEffect::PICKUP, playerPos, YELLOW, 40);
     }
 
     // --- K. CLEANUP & PENDING ---
-    mEnemies.erase(
-        std::remove_if(mEnemies.begin(), mEnemies.end(), 
-            [](const std::unique_ptr<BaseEnemy>& e){ return !e->IsActive(); }
-        ), 
-        mEnemies.end()
-    );
+    PROFILE_LAP(lap, ProfPhase::UPDATE_K_CLEANUP);
+    mEnemies.Compact(); // Buang musuh mati + masukin pending (split / minion)
     
     mGems.erase(
         std::remove_if(mGems.begin(), mGems.end(), 
@@ -636,18 +920,36 @@ void Game::Update(float dt) {
         ), 
         mGems.end()
     );
+}
+double Game::SecondsSinceStartup() const {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - mStartupTime).count();
+}
 
-    for (auto& pending : mPendingEnemies) {
-        mEnemies.push_back(std::move(pending));
+bool Game::LoadGameplayContent() {
+    // 1. Upload Model, Texture & Sound yang udah di-decode worker (dibatasi budget per frame)
+    if (mLoadingStage == 0) {
+        if (!mAssets.PumpAsyncLoad(LOADING_UPLOAD_BUDGET)) return false;
+        std::cout << "📦 ASSETS UPLOADED (" << (int)(SecondsSinceStartup() * 1000.0) << " ms)" << std::endl;
+        mLoadingStage = 1;
+        return false;
     }
-    mPendingEnemies.clear();
-}
-void Game::LoadGameplayContent() {
-    std::cout << "📦 LOADING HEAVY ASSETS (MODELS, MUSIC, SHADERS)..." << std::endl;
 
-    // 1. Load Semua Model & Sound
-    mAssets.LoadAll();
+    // 2. Compile shader (frame sendiri, driver bisa lama)
+    if (mLoadingStage == 1) {
+        LoadGameplayShaders();
+        mLoadingStage = 2;
+        return false;
+    }
+
+    // 3. Material, collision map, shadow, musik
+    FinishGameplayContent();
+
+    std::cout << "✅ ASSETS LOADED COMPLETELY! (" << (int)(SecondsSinceStartup() * 1000.0)
+              << " ms, frame loading terlama " << (int)(mLoadingLongestFrame * 1000.0f) << " ms)" << std::endl;
+    return true;
+}
 
+void Game::LoadGameplayShaders() {
     // 2. Setup Shaders
     mGroundShader = LoadShaderFromMemory(VS_CODE, FS_GROUND_CODE);
     mSlimeShader = LoadShaderFromMemory(VS_CODE, FS_SLIME_CODE);
@@ -660,19 +962,71 @@ void Game::LoadGameplayContent() {
     SetShaderValue(mGroundShader, mLightPosGroundLoc, &lightPos, SHADER_UNIFORM_VEC3);
     SetShaderValue(mSlimeShader, mLightPosSlimeLoc, &lightPos, SHADER_UNIFORM_VEC3);
 
-    // 3. Setup Materials
-    if (mAssets.GetModel("ground").meshCount > 0) {
-        mAssets.GetModel("ground").materials[0].shader = mGroundShader;
-        mAssets.GetModel("ground").materials[0].maps[MATERIAL_MAP_DIFFUSE].texture = mAssets.GetTexture("ground");
+    // 2b. Shader instanced (FS sama, VS baca instanceTransform)
+    mGroundInstShader = LoadShaderFromMemory(VS_INSTANCED_CODE, FS_GROUND_CODE);
+    mSlimeInstShader = LoadShaderFromMemory(VS_INSTANCED_CODE, FS_SLIME_CODE);
+    SetupInstancedShader(mGroundInstShader);
+    SetupInstancedShader(mSlimeInstShader);
+    mViewPosSlimeInstLoc = GetShaderLocation(mSlimeInstShader, "viewPos");
+
+    // 2c. Shader gem (instanced, bob/spin/warna di GPU)
+    mGemShader = LoadShaderFromMemory(VS_GEM_CODE, FS_GEM_CODE);
+    SetupInstancedShader(mGemShader);
+    mGemTimeLoc = GetShaderLocation(mGemShader, "time");
+    mGemMaterial = LoadMaterialDefault();
+    mGemMaterial.shader = mGemShader;
+    // Gagal compile = shader default, data instance-nya bukan transform beneran -> jalur DrawCube
+    if (mGemShader.id == rlGetShaderIdDefault()) mGemInstancing = false;
+
+    // 2d. Shader partikel (instanced, posisi/ukuran/warna per instance)
+    mParticleShader = LoadShaderFromMemory(VS_PARTICLE_CODE, FS_PARTICLE_CODE);
+    SetupInstancedShader(mParticleShader);
+    mParticleBillboardLoc = GetShaderLocation(mParticleShader, "billboard");
+    mParticleCamRightLoc = GetShaderLocation(mParticleShader, "camRight");
+    mParticleCamUpLoc = GetShaderLocation(mParticleShader, "camUp");
+    mParticleMaterial = LoadMaterialDefault();
+    mParticleMaterial.shader = mParticleShader;
+    mParticleQuad = GenMeshPlane(1.0f, 1.0f, 1, 1);
+    mParticleBatch.Reserve(PARTICLE_CAPACITY);
+    if (mParticleShader.id == rlGetShaderIdDefault()) mParticleInstancing = false;
+    SetShaderValue(mGroundInstShader, GetShaderLocation(mGroundInstShader, "lightPos"), &lightPos, SHADER_UNIFORM_VEC3);
+    SetShaderValue(mSlimeInstShader, GetShaderLocation(mSlimeInstShader, "lightPos"), &lightPos, SHADER_UNIFORM_VEC3);
+}
+
+void Game::FinishGameplayContent() {
+    // 3. Resolve nama aset -> handle (sekali aja, setelah semua aset masuk tabel)
+    mGroundModel = mAssets.FindModel("ground");
+    mPlayerModel = mAssets.FindModel("ayam");
+    mSlimeModel = mAssets.FindModel("slime");
+    mCubeModel = mAssets.FindModel("cube");
+    mMagnetModel = mAssets.FindModel("magnet");
+    mGroundTexture = mAssets.FindTexture("ground");
+    mSfx.Load(mAssets); // Alias numpang Sound "crack", jadi abis aset siap
+
+    // 3a. Setup Materials
+    Model& groundModel = mAssets.GetModel(mGroundModel);
+    if (groundModel.meshCount > 0) {
+        groundModel.materials[0].shader = mGroundShader;
+        groundModel.materials[0].maps[MATERIAL_MAP_DIFFUSE].texture = mAssets.GetTexture(mGroundTexture);
+    }
+    if (mAssets.GetModel(mSlimeModel).meshCount > 0) {
+        mAssets.GetModel(mSlimeModel).materials[0].shader = mSlimeShader;
     }
-    if (mAssets.GetModel("slime").meshCount > 0) {
-        mAssets.GetModel("slime").materials[0].shader = mSlimeShader;
+    if (mAssets.GetModel(mCubeModel).meshCount > 0) {
+        mAssets.GetModel(mCubeModel).materials[0].shader = mGroundShader;
     }
-    if (mAssets.GetModel("cube").meshCount > 0) {
-        mAssets.GetModel("cube").materials[0].shader = mGroundShader;
+    if (mAssets.GetModel(mPlayerModel).meshCount > 0) {
+        mAssets.GetModel(mPlayerModel).materials[0].shader = mGroundShader;
     }
-    if (mAssets.GetModel("ayam").meshCount > 0) {
-        mAssets.GetModel("ayam").materials[0].shader = mGroundShader;
+
+    // Material batch = copy material asli (maps/texture sama), shader diganti versi instanced
+    mEnemyBatches.cubeMaterial = mAssets.GetModel(mCubeModel).materials[0];
+    mEnemyBatches.cubeMaterial.shader = mGroundInstShader;
+    mEnemyBatches.slimeMaterial = mAssets.GetModel(mSlimeModel).materials[0];
+    mEnemyBatches.slimeMaterial.shader = mSlimeInstShader;
+    // Shader gagal compile (GPU tua) = raylib balikin shader default -> instancing dimatiin
+    if (mGroundInstShader.id == rlGetShaderIdDefault() || mSlimeInstShader.id == rlGetShaderIdDefault()) {
+        mEnemyInstancing = false;
     }
 
     // 3b. Load Collision Map
@@ -680,9 +1034,6 @@ void Game::LoadGameplayContent() {
 
     // 4. Shadow System
     mShadowTexture = GenerateShadowTexture(); 
-    if (mAssets.GetModel("shadow_plane").meshCount > 0) {
-        mAssets.GetModel("shadow_plane").materials[0].maps[MATERIAL_MAP_DIFFUSE].texture = mShadowTexture;
-    }
 
     // 5. Setup Music
     mBgMusic = &mAssets.GetMusic("bgm");
@@ -690,82 +1041,129 @@ void Game::LoadGameplayContent() {
         SetMusicVolume(*mBgMusic, 0.5f);
         PlayMusicStream(*mBgMusic);
     }
-    
-    std::cout << "✅ ASSETS LOADED COMPLETELY!" << std::endl;
 }
 void Game::Draw() {
+    // Total & lap dihentikan sebelum EndDrawing (biar vsync / frame limiter gak ikut keukur)
+    PROFILE_LAP_BEGIN(mProfiler, drawTotal);
+    PROFILE_LAP(drawTotal, ProfPhase::DRAW_TOTAL);
+    PROFILE_LAP_BEGIN(mProfiler, lap);
+
     // ==============================================================================
     // PHASE 1: 3D WORLD RENDER (Hanya saat Gameplay/Pause/Result)
     // ==============================================================================
     bool isGameplayActive = (mState == GameState::PLAYING || mState == GameState::PAUSED || 
                              mState == GameState::GAME_OVER || mState == GameState::VICTORY);
 
+    // Kamera render = interpolasi antara tick sebelumnya & sekarang
+    Camera3D renderCam = mCamera;
+    renderCam.position = Vector3Lerp(mPrevCamera.position, mCamera.position, mRenderAlpha);
+    renderCam.target = Vector3Lerp(mPrevCamera.target, mCamera.target, mRenderAlpha);
+
     if (isGameplayActive) {
+        PROFILE_LAP(lap, ProfPhase::DRAW_WORLD);
         if (mPixelMode) BeginTextureMode(mTarget);
         else BeginDrawing();
 
             ClearBackground((Color){ 20, 20, 25, 255 }); // Dark Blue-ish Gray
 
-            BeginMode3D(mCamera);
+            BeginMode3D(renderCam);
 
                 mLevelManager.Draw();
                 
                 // 1. Ground
-                if (mAssets.GetModel("ground").meshCount > 0) {
-                    DrawModelEx(mAssets.GetModel("ground"), (Vector3){0, -0.05f, 0}, 
+                Model& groundModel = mAssets.GetModel(mGroundModel);
+                if (groundModel.meshCount > 0) {
+                    DrawModelEx(groundModel, (Vector3){0, -0.05f, 0}, 
                                (Vector3){0,1,0}, 0.0f, (Vector3){1.0f, 1.0f, 1.0f}, WHITE);
                 } else {
                     DrawGrid(100, 1.0f);
                 }
 
                 // 2. Player (Selalu gambar kecuali loading)
-                mPlayer.Draw(mAssets.GetModel("ayam"), mCamera, mShadowTexture);
+                mPlayer.Draw(mAssets.GetModel(mPlayerModel), renderCam, mShadows, mRenderAlpha);
 
                 // 3. Update Shader Uniforms (Lighting Position)
-                SetShaderValue(mSlimeShader, mViewPosSlimeLoc, &mCamera.position, SHADER_UNIFORM_VEC3);
-                Vector3 playerPos = mPlayer.GetPosition();
-
-                // 4. Enemies
-                for (auto& e : mEnemies) {
-                    if (!e->IsActive()) continue;
-                    e->Draw(
-                        mAssets.GetModel("slime"),    
-                        mAssets.GetModel("cube"),     
-                        mAssets.GetModel("magnet"),   
-                        mAssets.GetModel("shadow_plane"), 
-                        mCamera,
-                        playerPos
-                    );
-                }
+                SetShaderValue(mSlimeShader, mViewPosSlimeLoc, &renderCam.position, SHADER_UNIFORM_VEC3);
+                SetShaderValue(mSlimeInstShader, mViewPosSlimeInstLoc, &renderCam.position, SHADER_UNIFORM_VEC3);
+                Vector3 playerPos = mPlayer.GetRenderPosition(mRenderAlpha);
+
+                // 4. Enemies (shadow semua entity 1 pass dulu, sebelum body transparan)
+                PROFILE_LAP(lap, ProfPhase::DRAW_ENEMIES);
+                mEnemies.SubmitShadows(mRenderAlpha, mShadows);
+                PROFILE_COUNTER(mProfiler, ProfCounter::SHADOW_CASTERS, mShadows.Count());
+                mShadows.Draw(mShadowTexture);
+
+                EnemyDrawContext enemyCtx = {
+                    &mAssets.GetModel(mSlimeModel),
+                    &mAssets.GetModel(mCubeModel),
+                    &mAssets.GetModel(mMagnetModel),
+                    renderCam,
+                    playerPos,
+                    mEnemyInstancing ? &mEnemyBatches : nullptr
+                };
+                mEnemies.Draw(mRenderAlpha, enemyCtx);
+                PROFILE_COUNTER(mProfiler, ProfCounter::ENEMY_DRAW_CALLS, mEnemies.DrawStats().drawCalls);
+                PROFILE_COUNTER(mProfiler, ProfCounter::ENEMY_INSTANCES, mEnemies.DrawStats().instances);
+                mEnemyProjectiles.Draw(mRenderAlpha);
 
                 // 5. Projectiles, Particles, Items
-                mProjectileManager.Draw(); 
-                mParticles.Draw();
-                mItemManager.Draw(mAssets.GetModel("magnet"));
+                PROFILE_LAP(lap, ProfPhase::DRAW_PARTICLES);
+                mProjectileManager.Draw(mRenderAlpha); 
+                if (mParticleInstancing) {
+                    // Sumbu kamera dari view matrix (baris 0 = kanan, baris 1 = atas)
+                    Matrix view = GetCameraMatrix(renderCam);
+                    Vector3 camRight = { view.m0, view.m4, view.m8 };
+                    Vector3 camUp = { view.m1, view.m5, view.m9 };
+                    float billboard = mParticleBillboard ? 1.0f : 0.0f;
+                    SetShaderValue(mParticleShader, mParticleBillboardLoc, &billboard, SHADER_UNIFORM_FLOAT);
+                    SetShaderValue(mParticleShader, mParticleCamRightLoc, &camRight, SHADER_UNIFORM_VEC3);
+                    SetShaderValue(mParticleShader, mParticleCamUpLoc, &camUp, SHADER_UNIFORM_VEC3);
+                    const Mesh& particleMesh = mParticleBillboard ? mParticleQuad : mAssets.GetModel(mCubeModel).meshes[0];
+                    mParticles.DrawInstanced(mParticleBatch, particleMesh, mParticleMaterial);
+                } else {
+                    mParticles.Draw();
+                }
+                PROFILE_COUNTER(mProfiler, ProfCounter::PARTICLE_INSTANCES, mParticles.Count());
+                PROFILE_COUNTER(mProfiler, ProfCounter::SFX_VOICES, mSfx.TotalVoicesInUse());
+                mItemManager.Draw(mAssets.GetModel(mMagnetModel));
 
                 // 6. XP Gems (Floating Cubes with Glow)
-                BeginBlendMode(BLEND_ADDITIVE);
-                for (const auto& g : mGems) {
-                    if (!g.active) continue;
-                    float time = GetTime();
-                    
-                    // Logic warna gem berdasarkan posisi sinyal
-                    Color xpColor = (sinf(time * 3.0f + g.position.x) > 0) ? YELLOW : GREEN;
-
-                    rlPushMatrix();
-                        float bob = sinf(time * 8.0f + g.position.x) * 0.15f;
-                        rlTranslatef(g.position.x, g.position.y + 0.3f + bob, g.position.z);
-                        rlRotatef(time * 150.0f, 0, 1, 0);
-                        rlRotatef(45.0f, 1, 0, 0);
-                        
-                        float size = 0.2f + (g.value * 0.005f); 
-                        if (size > 0.4f) size = 0.4f;
-
-                        DrawCube((Vector3){0,0,0}, size, size, size, xpColor);
-                        DrawCubeWires((Vector3){0,0,0}, size, size, size, WHITE);
-                    rlPopMatrix();
+                // 1 draw instanced: CPU cuma nulis posisi/ukuran/seed, bob-spin-warna di VS_GEM_CODE
+                PROFILE_LAP(lap, ProfPhase::DRAW_GEMS);
+                float gemTime = (float)GetTime();
+                if (mGemInstancing) {
+                    SetShaderValue(mGemShader, mGemTimeLoc, &gemTime, SHADER_UNIFORM_FLOAT);
+                    for (const auto& g : mGems) {
+                        if (!g.active) continue;
+                        Vector3 gemPos = Vector3Lerp(g.prevPosition, g.position, mRenderAlpha);
+                        float size = fminf(0.2f + (g.value * 0.005f), 0.4f);
+                        // Seed = posisi X (fase bob & kedip warna sama kayak dulu)
+                        mGemBatch.AddData((Vector4){ gemPos.x, gemPos.y, gemPos.z, size }, (Vector4){ g.position.x, 0, 0, 0 });
+                    }
+                    PROFILE_COUNTER(mProfiler, ProfCounter::GEM_INSTANCES, mGemBatch.Count());
+                    BeginBlendMode(BLEND_ADDITIVE);
+                        mGemBatch.Flush(mAssets.GetModel(mCubeModel).meshes[0], mGemMaterial);
+                    EndBlendMode();
+                } else {
+                    // Fallback (GPU tua): loop lama, bob-spin-warna dihitung CPU per gem
+                    BeginBlendMode(BLEND_ADDITIVE);
+                    for (const auto& g : mGems) {
+                        if (!g.active) continue;
+                        Vector3 gemPos = Vector3Lerp(g.prevPosition, g.position, mRenderAlpha);
+                        Color xpColor = (sinf(gemTime * 3.0f + g.position.x) > 0) ? YELLOW : GREEN;
+                        float size = fminf(0.2f + (g.value * 0.005f), 0.4f);
+
+                        rlPushMatrix();
+                            float bob = sinf(gemTime * 8.0f + g.position.x) * 0.15f;
+                            rlTranslatef(gemPos.x, gemPos.y + 0.3f + bob, gemPos.z);
+                            rlRotatef(gemTime * 150.0f, 0, 1, 0);
+                            rlRotatef(45.0f, 1, 0, 0);
+                            DrawCube((Vector3){0,0,0}, size, size, size, xpColor);
+                            DrawCubeWires((Vector3){0,0,0}, size, size, size, WHITE);
+                        rlPopMatrix();
+                    }
+                    EndBlendMode();
                 }
-                EndBlendMode();
                 
             EndMode3D();
 
@@ -775,6 +1173,7 @@ void Game::Draw() {
     // ==============================================================================
     // PHASE 2: UI & 2D OVERLAY
     // ==============================================================================
+    PROFILE_LAP(lap, ProfPhase::DRAW_UI);
     BeginDrawing();
     ClearBackground(BLACK); // Dasar Hitam Penting untuk Fade Out Splash
 
@@ -863,9 +1262,10 @@ void Game::Draw() {
                 DrawText(txt, mScreenWidth/2 - MeasureText(txt, 20)/2, barY - 30, 20, YELLOW);
             }
         } else {
-            // Masih Loading -> Bar Setengah (Pudar)
-            DrawRectangle(barX + 2, barY + 2, (barW - 4) / 2, barH - 4, frameColor);
-            DrawText("LOADING ASSETS...", barX, barY - 30, 20, frameColor);
+            // Masih Loading -> Bar sesuai progress asli (aset 90%, shader + material 10%)
+            float progress = mAssets.GetLoadProgress() * 0.9f + mLoadingStage * 0.05f;
+            DrawRectangle(barX + 2, barY + 2, (int)((barW - 4) * progress), barH - 4, frameColor);
+            DrawText(TextFormat("LOADING ASSETS... %d%%", (int)(progress * 100.0f)), barX, barY - 30, 20, frameColor);
         }
     }
 
@@ -903,10 +1303,10 @@ void Game::Draw() {
     // 5. GAMEPLAY HUD (Playing / Paused / Game Over)
     // --------------------------------------------------------------------------
     else if (mState == GameState::PLAYING) {
-        mUI.DrawHUD(mPlayer, mWaveManager, (int)mEnemies.size(), mScreenWidth, mScreenHeight);
+        mUI.DrawHUD(mPlayer, mWaveManager, mEnemies.Count(), mScreenWidth, mScreenHeight);
     }
     else if (mState == GameState::PAUSED) {
-        mUI.DrawHUD(mPlayer, mWaveManager, (int)mEnemies.size(), mScreenWidth, mScreenHeight);
+        mUI.DrawHUD(mPlayer, mWaveManager, mEnemies.Count(), mScreenWidth, mScreenHeight);
         mUI.DrawPause(mScreenWidth, mScreenHeight);
     }
     else if (mState == GameState::GAME_OVER) {
@@ -916,6 +1316,13 @@ void Game::Draw() {
         mUI.DrawVictory(mScreenWidth, mScreenHeight, mPlayer.GetLevel());
     }
 
+    PROFILE_LAP_STOP(lap);
+    PROFILE_LAP_STOP(drawTotal);
+
+#if MEGABONK_PROFILER
+    if (mProfiler.IsOverlayVisible()) mProfiler.DrawOverlay(10, 80);
+#endif
+
     EndDrawing();
 }
 
@@ -923,35 +1330,53 @@ void Game::SpawnEnemy(EnemySpawnEntry entry, Vector3 pos) {
     if (pos.x == 0 && pos.z == 0) {
         if (entry.type == EnemySpawnType::BOSS) {
             pos = {0, 0, 0};
-            mParticles.SpawnExplosion(pos, RED, 150);
+            mParticles.SpawnExplosion(ParticleEffect::BOSS_SPAWN, pos, RED, 150);
             mScreenShakeIntensity = 2.0f;
         } else {
-            float angle = GetRandomFloat(0, 360) * DEG2RAD;
-            float dist = GetRandomFloat(30, 50);
+            // Ring 30-50 unit dari player, tapi cuma di tempat kosong di dalam map. Di tembok / luar map
+            // SDF-nya minus, ResolveCircle bakal nyentak musuhnya belasan unit di tick pertama
+            const int SPAWN_TRIES = 8;
+            const float SPAWN_CLEARANCE = 4.0f; // Radius musuh biasa terbesar (CubeWalker tier 3)
             Vector3 playerPos = mPlayer.GetPosition();
-            pos = Vector3Add(playerPos, { cosf(angle) * dist, 0, sinf(angle) * dist });
+            float bestClearance = -COLLISION_WORLD_SIZE;
+            for (int attempt = 0; attempt < SPAWN_TRIES && bestClearance < SPAWN_CLEARANCE; attempt++) {
+                float angle = GetRandomFloat(0, 360) * DEG2RAD;
+                float dist = GetRandomFloat(30, 50);
+                Vector3 candidate = Vector3Add(playerPos, { cosf(angle) * dist, 0, sinf(angle) * dist });
+                float clearance = mLevelManager.GetWallDistance(candidate);
+                if (clearance > bestClearance) {
+                    bestClearance = clearance;
+                    pos = candidate;
+                }
+            }
+            // Player mojok di ujung map: pakai spawn point hasil compile (pixel merah),
+            // kalau map-nya gak punya ya titik paling lega dari percobaan di atas
+            int spawnCount = mLevelManager.GetEnemySpawnCount();
+            if (bestClearance < SPAWN_CLEARANCE && spawnCount > 0) {
+                pos = mLevelManager.GetEnemySpawnPoint(GetRandomValue(0, spawnCount - 1));
+            }
         }
     }
 
     switch (entry.type) {
         case EnemySpawnType::CUBE_WALKER:
-            mEnemies.push_back(std::make_unique<CubeWalker>(entry.tier, pos));
+            mEnemies.Spawn(EnemyType::CUBE_WALKER, entry.tier, pos);
             break;
             
         case EnemySpawnType::SHOOTER:
-            mEnemies.push_back(std::make_unique<ShooterEnemy>(entry.tier, pos));
+            mEnemies.Spawn(EnemyType::SHOOTER, entry.tier, pos);
             break;
             
         case EnemySpawnType::CHARGER:
-            mEnemies.push_back(std::make_unique<ChargerEnemy>(entry.tier, pos));
+            mEnemies.Spawn(EnemyType::CHARGER, entry.tier, pos);
             break;
             
         case EnemySpawnType::EXPLODER:
-            mEnemies.push_back(std::make_unique<ExploderEnemy>(entry.tier, pos));
+            mEnemies.Spawn(EnemyType::EXPLODER, entry.tier, pos);
             break;
             
         case EnemySpawnType::SLIME_JUMPER:
-            mEnemies.push_back(std::make_unique<SlimeJumper>(entry.tier, pos));
+            mEnemies.Spawn(EnemyType::SLIME_JUMPER, entry.tier, pos);
             break;
             
         case EnemySpawnType::BOSS:
@@ -959,7 +1384,7 @@ void Game::SpawnEnemy(EnemySpawnEntry entry, Vector3 pos) {
             break;
             
         case EnemySpawnType::MINI_BOSS:
-            mEnemies.push_back(std::make_unique<CubeWalker>(3, pos));
+            mEnemies.Spawn(EnemyType::CUBE_WALKER, 3, pos);
             break;
     }
 }
@@ -978,7 +1403,7 @@ void Game::SpawnBoss(int waveNumber, Vector3 pos) {
         bossType = BossType::ULTIMATE_BOSS;
     }
     
-    mEnemies.push_back(std::make_unique<BossEnemy>(bossType, pos, waveNumber));
+    mEnemies.SpawnBoss(bossType, pos, waveNumber);
 }
 Texture2D Game::GenerateShadowTexture() {
     Image img = GenImageGradientRadial(64, 64, 0.5f, (Color){0, 0, 0, 200}, (Color){0, 0, 0, 0});
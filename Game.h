@@ -4,20 +4,26 @@
 #include <vector>
 #include <memory>
 #include <string>
+#include <chrono>
 
 // --- SUB-SYSTEM INCLUDES ---
 #include "Player/Player.h"
 #include "Systems/WaveManager.h"
 #include "Systems/ProjectileManager.h"
+#include "Systems/EnemyProjectilePool.h"
 #include "Systems/ItemManager.h"
+#include "Systems/SpatialHashGrid.h"
+#include "Systems/FlowField.h"
 #include "Managers/ParticleSystem.h"
 #include "Managers/AssetManager.h"
+#include "Managers/SoundVoicePool.h"
 #include "Managers/UIManager.h"
 #include "Managers/MenuManager.h" // ✅ BARU: Tambahkan ini
 #include "Managers/LevelManager.h"
+#include "Managers/FrameProfiler.h"
 
 // ✅ ENEMY INCLUDES
-#include "Enemies/BaseEnemy.h"
+#include "Enemies/EnemyStore.h"
 #include "Enemies/CubeWalker.h"
 #include "Enemies/SlimeJumper.h"
 #include "Enemies/ShooterEnemy.h"
@@ -47,16 +53,51 @@ struct XPGem {
     float value;
     bool active;
     Vector3 velocity;
+    Vector3 prevPosition; // Posisi tick sebelumnya (buat interpolasi render)
+};
+
+// --- FIXED TIMESTEP CONFIG ---
+// Simulasi jalan di tick rate tetap, render interpolasi di antara 2 tick terakhir
+constexpr float SIM_TICK_RATE = 60.0f;              // Hz
+constexpr float SIM_FIXED_DT = 1.0f / SIM_TICK_RATE;
+constexpr int   SIM_MAX_CATCHUP_STEPS = 5;           // Anti spiral of death
+
+// 📦 Kapasitas awal EnemyStore (wave akhir + split + minion muat tanpa realloc)
+constexpr int   ENEMY_POOL_CAPACITY = 1024;
+// 💎 Kapasitas awal batch gem (wave akhir bisa ratusan orb di lantai)
+constexpr int   GEM_BATCH_CAPACITY = 2048;
+// 🎯 Kapasitas pool peluru musuh (Shooter + Boss). Penuh = peluru baru dibuang
+constexpr int   ENEMY_BULLET_CAPACITY = 2048;
+// ✨ Kapasitas pool partikel (boss mati + chain kill wave akhir). Penuh = sisa burst dibuang
+constexpr int   PARTICLE_CAPACITY = 32768;
+// ⏳ Budget upload aset (GPU / audio device) per frame selama LOADING
+constexpr double LOADING_UPLOAD_BUDGET = 0.008;
+
+// --- HEADLESS MODE ---
+// megabonk --headless --waves 25 --ticks N
+// Simulasi jalan tanpa window / audio device, input dari bot script.
+struct HeadlessConfig {
+    bool enabled = false;
+    int targetWave = 25;     // Stop setelah wave ini selesai
+    long maxTicks = 0;       // 0 = gak dibatasi (sampai wave target / game over)
+    unsigned int seed = 0;   // 0 = seed default raylib
+    bool godMode = false;    // Player kebal (buat soak test wave akhir)
+    int weapon = -1;         // -1 = default (Pistol), 0-3 = Pistol..Bazooka
+    std::string profileCsv;  // Kalau diisi: dump tabel profiler ke CSV di akhir run
 };
 
 // --- GAME CLASS ---
 
 class Game {
 public:
-    Game(int width, int height);
+    Game(int width, int height, HeadlessConfig headless = {});
     ~Game();
 
     void Run();
+    void RunHeadless(); // Loop simulasi murni tanpa render
+
+    // 🧠 AI LOD (jarak update musuh jauh + budget per tick), default di AiLodConfig
+    void SetAiLod(const AiLodConfig& config) { mEnemies.SetAiLod(config); }
 
 private:
     void ProcessInput(float dt);
@@ -64,6 +105,14 @@ private:
     void Draw();
     void ResetGame();
 
+    // ✅ INPUT (Platform I/O dipisah dari simulasi)
+    void PollInput();             // Keyboard/mouse -> mInput (mode window)
+    PlayerInput BuildScriptedInput(); // Bot sederhana (mode headless)
+
+    // ✅ FIXED TIMESTEP HELPERS
+    bool IsSimulationState() const;
+    void SavePreviousState(); // Snapshot posisi sebelum tick baru
+
     // ✅ SPAWN METHODS
     void SpawnEnemy(EnemySpawnEntry entry, Vector3 pos = {0, 0, 0});
     void SpawnBoss(int waveNumber, Vector3 pos);
@@ -84,10 +133,28 @@ private:
     bool mWaveBonusClaimed;
     
     bool mGameLoaded;
-    int mLoadingFrameDelay;
+    int mLoadingStage;          // 0 = upload aset, 1 = shader, 2 = material/map/musik
+    float mLoadingLongestFrame; // Frame terlama selama loading (cek window tetap responsif)
+    bool mStartupLogged;
+    double mMenuReadySeconds;   // Detik sejak start sampai LoadGameplayContent() beres
+    std::chrono::steady_clock::time_point mStartupTime;
+
+    // --- HEADLESS ---
+    HeadlessConfig mHeadless;
+    long mHeadlessTick;
+
+    // --- INPUT SNAPSHOT ---
+    PlayerInput mInput;
+
+    // --- FIXED TIMESTEP ---
+    float mSimAccumulator; // Sisa waktu frame yang belum disimulasikan
+    float mRenderAlpha;    // 0..1 posisi render di antara tick lama & baru
 
     // --- SYSTEMS ---
-    void LoadGameplayContent(); // Helper func
+    bool LoadGameplayContent(); // Maju 1 tahap per frame, true = semua siap
+    void LoadGameplayShaders();
+    void FinishGameplayContent();
+    double SecondsSinceStartup() const;
     
     // Assets & Resources
     Texture2D mSplashLogo;
@@ -98,7 +165,16 @@ private:
     MenuManager mMenuManager;      
     
     Camera3D mCamera;
+    Camera3D mPrevCamera; // Kamera tick sebelumnya (buat interpolasi)
     AssetManager mAssets;
+    // 🔑 Handle aset hot path (resolve sekali di FinishGameplayContent, bukan lookup string tiap frame)
+    ModelHandle mGroundModel;
+    ModelHandle mPlayerModel;
+    ModelHandle mSlimeModel;
+    ModelHandle mCubeModel;
+    ModelHandle mMagnetModel;
+    TextureHandle mGroundTexture;
+    SoundVoicePool mSfx; // 🔊 Alias + batas voice buat SFX peluru (abis mAssets: dihancurin duluan)
     Player mPlayer;
     WaveManager mWaveManager;
     ProjectileManager mProjectileManager;
@@ -106,6 +182,7 @@ private:
     ParticleSystem mParticles;
     UIManager mUI;
     LevelManager mLevelManager;
+    FrameProfiler mProfiler; // ⏱️ F3 = overlay, F4 = dump CSV
 
     // --- RENDERING ---
     Shader mGroundShader;
@@ -114,12 +191,43 @@ private:
     int mLightPosSlimeLoc;
     int mViewPosSlimeLoc;
     Texture2D mShadowTexture;
+    ShadowBatch mShadows; // 🌑 Blob shadow player + musuh, 1 pass per frame
+
+    // 🧊 Instancing musuh (F6 = on/off, bandingin draw call di overlay F3)
+    Shader mGroundInstShader;
+    Shader mSlimeInstShader;
+    int mViewPosSlimeInstLoc;
+    EnemyInstanceBatches mEnemyBatches;
+    bool mEnemyInstancing;
+
+    // 💎 XP gem instanced
+    Shader mGemShader;
+    int mGemTimeLoc;
+    Material mGemMaterial;
+    InstanceBatch mGemBatch;
+    bool mGemInstancing; // false = shader gem gagal compile, balik ke DrawCube per gem
+
+    // ✨ Partikel instanced (F7 = kubus / billboard ngadep kamera)
+    Shader mParticleShader;
+    int mParticleBillboardLoc;
+    int mParticleCamRightLoc;
+    int mParticleCamUpLoc;
+    Material mParticleMaterial;
+    Mesh mParticleQuad; // Plane 1x1 buat mode billboard (kubus pakai mesh "cube")
+    InstanceBatch mParticleBatch;
+    bool mParticleInstancing;
+    bool mParticleBillboard;
 
     // --- ENTITIES ---
-    std::vector<std::unique_ptr<BaseEnemy>> mEnemies;
-    std::vector<std::unique_ptr<BaseEnemy>> mPendingEnemies;
+    EnemyStore mEnemies; // SoA: 1 row per musuh (spawn split/minion masuk pending)
+    EnemyProjectilePool mEnemyProjectiles; // Peluru Shooter & Boss (kapasitas tetap)
     std::vector<XPGem> mGems;
 
+    // --- SPATIAL QUERY ---
+    SpatialHashGrid mEnemyGrid;       // Rebuild tiap tick (separation di F, lalu section H)
+    FlowField mFlowField;             // Arah ke player per cell collision map (rebuild kalau player pindah cell)
+    std::vector<int> mGridCandidates; // Scratch hasil query (biar gak alokasi)
+
     // --- AUDIO ---
     Music* mBgMusic;
 
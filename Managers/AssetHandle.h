@@ -0,0 +1,77 @@
+#pragma once
+#include "raylib.h"
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+// 🔑 HANDLE ASET: resolve nama sekali (map string), lalu hot path cuma index array.
+// generation = "angkatan" tabel. UnloadAll naikin generation -> handle lama jadi basi (stale).
+template <typename T>
+struct AssetHandle {
+    int index = -1;
+    uint32_t generation = 0;
+
+    bool IsValid() const { return index >= 0; }
+};
+
+using ModelHandle = AssetHandle<Model>;
+using TextureHandle = AssetHandle<Texture2D>;
+using MusicHandle = AssetHandle<Music>;
+using SoundHandle = AssetHandle<Sound>;
+
+// Tabel 1 jenis aset: array rapat + index nama (cuma dipakai pas Insert / Find)
+template <typename T>
+class AssetTable {
+public:
+    AssetTable() : mGeneration(1) {}
+
+    // Nama sama = timpa slot lama (handle lama tetap nunjuk slot yang sama)
+    AssetHandle<T> Insert(const std::string& name, const T& asset) {
+        auto it = mIndex.find(name);
+        int index;
+        if (it != mIndex.end()) {
+            index = it->second;
+            mItems[index] = asset;
+        } else {
+            index = (int)mItems.size();
+            mItems.push_back(asset);
+            mIndex[name] = index;
+        }
+        return AssetHandle<T>{ index, mGeneration };
+    }
+
+    // Gak ketemu = handle invalid (index -1)
+    AssetHandle<T> Find(const std::string& name) const {
+        auto it = mIndex.find(name);
+        if (it == mIndex.end()) return AssetHandle<T>{};
+        return AssetHandle<T>{ it->second, mGeneration };
+    }
+
+    // O(1). nullptr kalau invalid / di luar tabel / basi
+    T* Get(AssetHandle<T> handle) {
+        if (handle.index < 0 || handle.index >= (int)mItems.size()) return nullptr;
+#ifndef NDEBUG
+        // 🐞 Debug: handle dari sebelum UnloadAll -> slot-nya udah bukan aset yang sama
+        if (handle.generation != mGeneration) {
+            TraceLog(LOG_WARNING, "ASSET HANDLE STALE: index %d (gen %u, sekarang %u)", handle.index, handle.generation, mGeneration);
+            return nullptr;
+        }
+#endif
+        return &mItems[handle.index];
+    }
+
+    // Semua handle yang udah dibagi jadi basi
+    void Clear() {
+        mItems.clear();
+        mIndex.clear();
+        mGeneration++;
+    }
+
+    std::vector<T>& Items() { return mItems; }
+
+private:
+    std::vector<T> mItems;
+    std::map<std::string, int> mIndex;
+    uint32_t mGeneration;
+};
@@ -1,107 +1,437 @@
 #include "AssetManager.h"
 #include <cstdio>
+#include <cstring>
+#include <iostream>
 #include "raymath.h"
 #include "AudioGenerator.h"
 
 // --- HELPER FUNCTION ---
-static Model LoadModelSafe(const char* path, Mesh fallbackMesh) {
-    if (FileExists(path)) {
-        return LoadModel(path);
+
+// Baca 1 file utuh ke buffer MemAlloc (aman di worker thread, gak lewat callback raylib)
+static unsigned char* ReadWholeFile(const char* path, int* outSize) {
+    *outSize = 0;
+    FILE* file = fopen(path, "rb");
+    if (file == nullptr) return nullptr;
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (size <= 0) {
+        fclose(file);
+        return nullptr;
+    }
+
+    unsigned char* data = (unsigned char*)MemAlloc((unsigned int)size);
+    size_t read = fread(data, 1, (size_t)size, file);
+    fclose(file);
+    if (read != (size_t)size) {
+        MemFree(data);
+        return nullptr;
     }
-    TraceLog(LOG_WARNING, "ASSET MISSING: '%s' fallback used.", path);
-    return LoadModelFromMesh(fallbackMesh);
+    *outSize = (int)size;
+    return data;
 }
 
-static Texture2D LoadTextureSafe(const char* path) {
-    if (FileExists(path)) {
-        return LoadTexture(path);
+// ".png" dari "folder/file.png" (GetFileExtension raylib pakai buffer static -> gak thread safe)
+static std::string FileExtension(const std::string& path) {
+    size_t dot = path.find_last_of('.');
+    if (dot == std::string::npos) return "";
+    return path.substr(dot);
+}
+
+// Fallback mesh (dipanggil di main thread, GenMesh* langsung upload ke GPU)
+static Mesh MakeChickenFallback() { return GenMeshCylinder(0.5f, 1.0f, 16); }
+static Mesh MakeMagnetFallback()  { return GenMeshCube(0.5f, 0.5f, 0.5f); }
+static Mesh MakeCubeMesh()        { return GenMeshCube(1.0f, 1.0f, 1.0f); }
+static Mesh MakeSlimeMesh()       { return GenMeshSphere(1.0f, 32, 32); }
+static Mesh MakeGroundMesh()      { return GenMeshPlane(100.0f, 100.0f, 1, 1); }
+
+// LoadModel raylib baca file sendiri -> selama upload, callback ini kasih byte yang udah dibaca worker
+static AssetJob* sPreloadedJob = nullptr;
+
+static unsigned char* LoadPreloadedFileData(const char* fileName, int* dataSize) {
+    if (sPreloadedJob != nullptr && sPreloadedJob->fileData != nullptr && sPreloadedJob->path == fileName) {
+        // Kepemilikan buffer pindah ke raylib (nanti di-UnloadFileData / MemFree)
+        unsigned char* data = sPreloadedJob->fileData;
+        *dataSize = sPreloadedJob->fileSize;
+        sPreloadedJob->fileData = nullptr;
+        sPreloadedJob->fileSize = 0;
+        return data;
     }
-    TraceLog(LOG_WARNING, "ASSET MISSING: '%s' dummy used.", path);
-    Image img = GenImageChecked(64, 64, 8, 8, DARKGRAY, GRAY);
-    Texture2D tex = LoadTextureFromImage(img);
-    UnloadImage(img);
-    return tex;
+    // File lain (mis. .bin eksternal glTF): baca biasa
+    return ReadWholeFile(fileName, dataSize);
 }
 // -----------------------
 
-AssetManager::AssetManager() {}
+AssetManager::AssetManager()
+    : mCpuReady(0)
+    , mCancel(false)
+    , mNextUpload(0)
+    , mLoading(false)
+    , mLoaded(false)
+{}
 AssetManager::~AssetManager() { UnloadAll(); }
 
-void AssetManager::LoadAll() {
+void AssetManager::BuildJobList(std::vector<AssetJob>& jobs) {
+    jobs.clear();
+
+    auto add = [&jobs](AssetJobType type, const char* name, const char* path) -> AssetJob& {
+        AssetJob job;
+        job.type = type;
+        job.name = name;
+        job.path = path;
+        jobs.push_back(job);
+        return jobs.back();
+    };
+
     // 1. MODELS
-    mModels["ayam"]   = LoadModelSafe("Resources/Models/Chicken.glb", GenMeshCylinder(0.5f, 1.0f, 16));
-    mModels["magnet"] = LoadModelSafe("Resources/Models/Magnet.glb",  GenMeshCube(0.5f, 0.5f, 0.5f));
-    
+    add(AssetJobType::MODEL_FILE, "ayam", "Resources/Models/Chicken.glb").makeMesh = MakeChickenFallback;
+    add(AssetJobType::MODEL_FILE, "magnet", "Resources/Models/Magnet.glb").makeMesh = MakeMagnetFallback;
+
     // 2. PROCEDURAL & DIRECT LOAD
-    mModels["cube"]        = LoadModelFromMesh(GenMeshCube(1.0f, 1.0f, 1.0f));
-    mModels["slime"]       = LoadModelFromMesh(GenMeshSphere(1.0f, 32, 32));
-    mModels["ground"]      = LoadModelFromMesh(GenMeshPlane(100.0f, 100.0f, 1, 1));
-    mModels["shadow_plane"] = LoadModelFromMesh(GenMeshPlane(1.0f, 1.0f, 1, 1));
+    add(AssetJobType::MODEL_PROCEDURAL, "cube", "mesh/cube").makeMesh = MakeCubeMesh;
+    add(AssetJobType::MODEL_PROCEDURAL, "slime", "mesh/slime").makeMesh = MakeSlimeMesh;
+    add(AssetJobType::MODEL_PROCEDURAL, "ground", "mesh/ground").makeMesh = MakeGroundMesh;
 
     // 3. TEXTURES
-    mTextures["ground"]    = LoadTextureSafe("ground.png");
+    add(AssetJobType::TEXTURE, "ground", "ground.png");
 
     // 4. AUDIO
-    mMusics["bgm"] = LoadMusicStream("Resources/.mp3");
-    mMusics["bgm"].looping = true;
+    add(AssetJobType::MUSIC, "bgm", "Resources/.mp3");
+
+    int recipeCount = 0;
+    const AudioGenerator::SoundRecipe* recipes = AudioGenerator::GetRecipes(recipeCount);
+    for (int i = 0; i < recipeCount; i++) {
+        AssetJob& job = add(AssetJobType::SOUND_PROCEDURAL, recipes[i].name, "");
+        job.waveType = recipes[i].type;
+        job.frequency = recipes[i].frequency;
+        job.duration = recipes[i].duration;
+        job.volume = 0.2f;
+    }
+
+    add(AssetJobType::SOUND_FILE, "gun", "Resources/gunshoot.mp3").volume = 0.02f;
+    add(AssetJobType::SOUND_FILE, "crack", "Resources/zapsplat_food_egg_raw_crack_open_yolk_squelch_110912.mp3").volume = 0.02f;
+}
 
-    AudioGenerator::GenerateAllSounds(mSounds);
+void AssetManager::BeginAsyncLoad() {
+    if (mLoading || mLoaded) return;
 
-    for (auto& entry : mSounds) {
-        SetSoundVolume(entry.second, 0.2f);
+    BuildJobList(mJobs);
+    if (mPack.Open(ASSET_PACK_PATH)) {
+        std::cout << "📦 ASSET PACK: " << ASSET_PACK_PATH << " (" << mPack.Count() << " entries)" << std::endl;
     }
+    mCpuReady.store(0, std::memory_order_relaxed);
+    mCancel.store(false, std::memory_order_relaxed);
+    mNextUpload = 0;
+    mLoading = true;
 
-    mSounds["gun"] = LoadSound("Resources/gunshoot.mp3");
-    SetSoundVolume(mSounds["gun"], 0.02f);
+    // Vector job gak berubah ukuran lagi sampai worker di-join -> referensi ke elemen aman
+    mWorker = std::thread(&AssetManager::WorkerMain, this);
+    std::cout << "⏳ ASSET LOADER: " << mJobs.size() << " jobs queued" << std::endl;
+}
+
+void AssetManager::WorkerMain() {
+    for (size_t i = 0; i < mJobs.size(); i++) {
+        if (mCancel.load(std::memory_order_relaxed)) return;
+        LoadJobCpu(mJobs[i]);
+        // Release: isi job kelihatan utuh di main thread sebelum counter-nya
+        mCpuReady.store((int)i + 1, std::memory_order_release);
+    }
+}
 
-    mSounds["crack"] = LoadSound("Resources/zapsplat_food_egg_raw_crack_open_yolk_squelch_110912.mp3");
-    SetSoundVolume(mSounds["crack"], 0.02f);
+// Byte 1 aset: dari pack (pointer ke mmap / hasil LZ4) atau fallback file lepas.
+// Return buffer yang wajib di-MemFree (nullptr = minjem langsung dari mmap, atau gak ketemu)
+unsigned char* AssetManager::ReadAssetBytes(AssetJob& job, const unsigned char** outData, int* outSize) const {
+    *outData = nullptr;
+    *outSize = 0;
 
+    const AssetPackEntry* entry = mPack.Find(job.path);
+    // File lepas yang diedit setelah di-pack menang (gak perlu pack ulang tiap ganti aset pas dev).
+    // Cuma stat, aman dari worker. File lepas gak ada (build rilis) = pakai pack
+    if (entry != nullptr && entry->kind == AssetPackKind::FILE && FileExists(job.path.c_str())
+        && ((uint32_t)GetFileLength(job.path.c_str()) != entry->rawSize || GetFileModTime(job.path.c_str()) != entry->sourceModTime)) {
+        TraceLog(LOG_INFO, "ASSET PACK: '%s' basi (file lepas berubah), baca file lepas", job.path.c_str());
+        entry = nullptr;
+    }
+    if (entry != nullptr && entry->kind == AssetPackKind::FILE) {
+        unsigned char* owned = nullptr;
+        if (mPack.Read(*entry, outData, outSize, &owned)) {
+            job.fromPack = true;
+            return owned;
+        }
+        TraceLog(LOG_WARNING, "ASSET PACK: entry '%s' rusak, baca file lepas", job.path.c_str());
+    }
 
+    unsigned char* owned = ReadWholeFile(job.path.c_str(), outSize);
+    *outData = owned;
+    return owned;
 }
 
-void AssetManager::UnloadAll() {
-    for (auto& pair : mModels) UnloadModel(pair.second);
-    for (auto& pair : mTextures) UnloadTexture(pair.second);
-    for (auto& pair : mMusics) UnloadMusicStream(pair.second);
-    mModels.clear();
-    mTextures.clear();
-    mMusics.clear();
+// 🧵 WORKER THREAD: cuma CPU. Jangan panggil apa pun yang nyentuh GL / audio device di sini
+void AssetManager::LoadJobCpu(AssetJob& job) const {
+    const unsigned char* data = nullptr;
+    int size = 0;
+
+    switch (job.type) {
+        case AssetJobType::MODEL_FILE: {
+            // LoadModel raylib nge-free buffer-nya sendiri -> harus buffer milik kita, bukan mmap
+            unsigned char* owned = ReadAssetBytes(job, &data, &size);
+            if (data != nullptr && owned == nullptr) {
+                owned = (unsigned char*)MemAlloc((unsigned int)size);
+                memcpy(owned, data, size);
+            }
+            job.fileData = owned;
+            job.fileSize = size;
+            break;
+        }
+
+        case AssetJobType::MUSIC: {
+            // Stream baca byte-nya terus selama main -> mmap pack (hidup sampai UnloadAll) dipakai langsung
+            job.fileData = ReadAssetBytes(job, &data, &size);
+            job.borrowedData = (job.fileData == nullptr) ? data : nullptr;
+            job.fileSize = size;
+            break;
+        }
+
+        case AssetJobType::TEXTURE: {
+            unsigned char* owned = ReadAssetBytes(job, &data, &size);
+            if (data != nullptr) job.image = LoadImageFromMemory(FileExtension(job.path).c_str(), data, size);
+            if (owned != nullptr) MemFree(owned);
+            break;
+        }
+
+        case AssetJobType::SOUND_FILE: {
+            unsigned char* owned = ReadAssetBytes(job, &data, &size);
+            if (data != nullptr) job.wave = LoadWaveFromMemory(FileExtension(job.path).c_str(), data, size);
+            if (owned != nullptr) MemFree(owned);
+            break;
+        }
+
+        case AssetJobType::SOUND_PROCEDURAL: {
+            // Launch kedua dst: PCM matang dari cache disk, gak masak ulang
+            AudioGenerator::SoundRecipe recipe = { job.name.c_str(), job.waveType, job.frequency, job.duration };
+            job.wave = AudioGenerator::LoadCachedWave(recipe, &job.fromCache);
+            break;
+        }
+
+        case AssetJobType::MODEL_PROCEDURAL: {
+            // Mesh udah di-bake di pack: tinggal copy array, gak usah GenMesh* lagi
+            const AssetPackEntry* entry = mPack.Find(job.path);
+            if (entry == nullptr || entry->kind != AssetPackKind::MESH) break;
+            unsigned char* owned = nullptr;
+            if (mPack.Read(*entry, &data, &size, &owned) && DecodePackedMesh(data, size, job.mesh)) {
+                job.fromPack = true;
+            }
+            if (owned != nullptr) MemFree(owned);
+            break;
+        }
+    }
 }
 
-Model& AssetManager::GetModel(const std::string& name) {
-    if (mModels.find(name) == mModels.end()) return mModels["cube"]; 
-    return mModels[name];
+// 🎮 MAIN THREAD: upload hasil worker ke GPU / audio device
+void AssetManager::UploadJob(AssetJob& job) {
+    switch (job.type) {
+        case AssetJobType::MODEL_FILE:
+            if (job.fileData != nullptr) {
+                // Parse glb tetap di sini: LoadModel raylib parse + upload sekaligus, cuma I/O yang pindah ke worker
+                sPreloadedJob = &job;
+                SetLoadFileDataCallback(LoadPreloadedFileData);
+                mModels.Insert(job.name, LoadModel(job.path.c_str()));
+                SetLoadFileDataCallback(nullptr);
+                sPreloadedJob = nullptr;
+            } else {
+                TraceLog(LOG_WARNING, "ASSET MISSING: '%s' fallback used.", job.path.c_str());
+                mModels.Insert(job.name, LoadModelFromMesh(job.makeMesh()));
+            }
+            break;
+
+        case AssetJobType::MODEL_PROCEDURAL:
+            if (job.mesh.vertexCount > 0) {
+                UploadMesh(&job.mesh, false);
+                mModels.Insert(job.name, LoadModelFromMesh(job.mesh));
+                job.mesh = Mesh{ 0 }; // Array-nya sekarang milik model
+            } else {
+                mModels.Insert(job.name, LoadModelFromMesh(job.makeMesh()));
+            }
+            break;
+
+        case AssetJobType::TEXTURE:
+            if (job.image.data == nullptr) {
+                TraceLog(LOG_WARNING, "ASSET MISSING: '%s' dummy used.", job.path.c_str());
+                job.image = GenImageChecked(64, 64, 8, 8, DARKGRAY, GRAY);
+            }
+            mTextures.Insert(job.name, LoadTextureFromImage(job.image));
+            break;
+
+        case AssetJobType::MUSIC: {
+            Music music = { 0 };
+            const unsigned char* bytes = (job.fileData != nullptr) ? job.fileData : job.borrowedData;
+            if (bytes != nullptr) {
+                music = LoadMusicStreamFromMemory(FileExtension(job.path).c_str(), bytes, job.fileSize);
+            }
+            if (music.ctxData != nullptr) {
+                music.looping = true;
+                // Stream decode dari buffer ini selama musik hidup (yang dari mmap pack gak perlu disimpan)
+                if (job.fileData != nullptr) mMusicData[job.name] = job.fileData;
+                job.fileData = nullptr;
+            } else {
+                TraceLog(LOG_WARNING, "ASSET MISSING: '%s' music skipped.", job.path.c_str());
+            }
+            mMusics.Insert(job.name, music);
+            break;
+        }
+
+        case AssetJobType::SOUND_FILE:
+        case AssetJobType::SOUND_PROCEDURAL: {
+            Sound sound = { 0 };
+            if (job.wave.data != nullptr) {
+                sound = LoadSoundFromWave(job.wave);
+                SetSoundVolume(sound, job.volume);
+            }
+            mSounds.Insert(job.name, sound);
+            break;
+        }
+    }
+    FreeJobPayload(job);
 }
 
-Texture2D& AssetManager::GetTexture(const std::string& name) {
-    if (mTextures.find(name) == mTextures.end()) return mTextures["crosshair"];
-    return mTextures[name];
+void AssetManager::FreeJobPayload(AssetJob& job) {
+    if (job.image.data != nullptr) UnloadImage(job.image);
+    if (job.wave.data != nullptr) UnloadWave(job.wave);
+    if (job.fileData != nullptr) MemFree(job.fileData);
+    // Mesh pack yang gak jadi di-upload: cuma array CPU, jangan lewat UnloadMesh (GL)
+    MemFree(job.mesh.vertices);
+    MemFree(job.mesh.texcoords);
+    MemFree(job.mesh.normals);
+    MemFree(job.mesh.indices);
+    job.image = Image{ 0 };
+    job.wave = Wave{ 0 };
+    job.fileData = nullptr;
+    job.fileSize = 0;
+    job.borrowedData = nullptr;
+    job.mesh = Mesh{ 0 };
 }
 
-Music& AssetManager::GetMusic(const std::string& name) {
-    if (mMusics.find(name) == mMusics.end()) {
-        static Music dummy = { 0 };
-        return dummy;
+bool AssetManager::PumpAsyncLoad(double budgetSeconds) {
+    if (mLoaded) return true;
+    if (!mLoading) BeginAsyncLoad();
+
+    // Acquire: pasangan release di WorkerMain
+    int ready = mCpuReady.load(std::memory_order_acquire);
+    double start = GetTime();
+    bool first = true;
+
+    // Minimal 1 upload per pump (biar progress jalan walau 1 aset makan > budget)
+    while (mNextUpload < ready) {
+        if (!first && GetTime() - start >= budgetSeconds) break;
+        UploadJob(mJobs[mNextUpload]);
+        mNextUpload++;
+        first = false;
     }
-    return mMusics[name];
+
+    if (mNextUpload < (int)mJobs.size()) return false;
+
+    if (mWorker.joinable()) mWorker.join();
+    int packed = 0;
+    int cached = 0;
+    for (const auto& job : mJobs) {
+        packed += job.fromPack ? 1 : 0;
+        cached += job.fromCache ? 1 : 0;
+    }
+    std::cout << "✅ ASSET LOADER: " << mJobs.size() << " assets ready (" << packed << " dari pack, "
+              << cached << " sfx dari cache)" << std::endl;
+    mJobs.clear();
+    mLoading = false;
+    mLoaded = true;
+    return true;
+}
+
+float AssetManager::GetLoadProgress() const {
+    if (mLoaded) return 1.0f;
+    if (mJobs.empty()) return 0.0f;
+    // Tiap job = 2 langkah (CPU worker + upload main)
+    int done = mCpuReady.load(std::memory_order_relaxed) + mNextUpload;
+    return (float)done / (float)(mJobs.size() * 2);
 }
 
-Sound& AssetManager::GetSound(const std::string& name) {
-    if (mSounds.find(name) == mSounds.end()) {
-        static Sound dummy = { 0 }; 
-        return dummy;
+const char* AssetManager::GetLoadingLabel() const {
+    if (mLoaded || mNextUpload >= (int)mJobs.size()) return "";
+    return mJobs[mNextUpload].name.c_str();
+}
+
+void AssetManager::LoadAll() {
+    BeginAsyncLoad();
+    // Sinkron: upload sebanyak mungkin tiap putaran sampai worker beres
+    while (!PumpAsyncLoad(1.0)) {
+        std::this_thread::yield();
     }
-    return mSounds[name];
 }
 
-bool AssetManager::IsSoundReady(std::string name) {
-    // 1. Cek apakah key string ada di dalam map
-    if (mSounds.find(name) == mSounds.end()) {
-        return false;
+void AssetManager::StopWorker() {
+    mCancel.store(true, std::memory_order_relaxed);
+    if (mWorker.joinable()) mWorker.join();
+    for (auto& job : mJobs) FreeJobPayload(job);
+    mJobs.clear();
+    mNextUpload = 0;
+    mLoading = false;
+}
+
+void AssetManager::UnloadAll() {
+    StopWorker(); // Keluar pas masih loading: worker harus berhenti sebelum buffer-nya dibuang
+
+    for (Model& model : mModels.Items()) UnloadModel(model);
+    for (Texture2D& texture : mTextures.Items()) UnloadTexture(texture);
+    for (Music& music : mMusics.Items()) {
+        if (music.ctxData != nullptr) UnloadMusicStream(music);
+    }
+    for (Sound& sound : mSounds.Items()) {
+        if (sound.frameCount > 0) UnloadSound(sound);
     }
+    for (auto& pair : mMusicData) MemFree(pair.second);
+    mPack.Close(); // Setelah music stream di-unload (bisa masih baca dari mmap)
+    mModels.Clear(); // Handle lama jadi basi
+    mTextures.Clear();
+    mMusics.Clear();
+    mSounds.Clear();
+    mMusicData.clear();
+    mLoaded = false;
+}
+
+Model& AssetManager::GetModel(ModelHandle handle) {
+    Model* model = mModels.Get(handle);
+    if (model != nullptr) return *model;
+
+    // Fallback: cube (kalau cube sendiri belum ada, model kosong)
+    model = mModels.Get(mModels.Find("cube"));
+    if (model != nullptr) return *model;
+    static Model dummy = { 0 };
+    return dummy;
+}
 
-    // 2. Cek manual apakah sound memiliki data (frameCount > 0)
+Texture2D& AssetManager::GetTexture(TextureHandle handle) {
+    Texture2D* texture = mTextures.Get(handle);
+    if (texture != nullptr) return *texture;
+    static Texture2D dummy = { 0 };
+    return dummy;
+}
+
+Music& AssetManager::GetMusic(MusicHandle handle) {
+    Music* music = mMusics.Get(handle);
+    if (music != nullptr) return *music;
+    static Music dummy = { 0 };
+    return dummy;
+}
+
+Sound& AssetManager::GetSound(SoundHandle handle) {
+    Sound* sound = mSounds.Get(handle);
+    if (sound != nullptr) return *sound;
+    static Sound dummy = { 0 };
+    return dummy;
+}
+
+bool AssetManager::IsSoundReady(SoundHandle handle) {
+    // Cek manual apakah sound memiliki data (frameCount > 0)
     // Ini cara manual pengganti ::IsSoundReady()
-    return (mSounds[name].frameCount > 0);
-}
\ No newline at end of file
+    Sound* sound = mSounds.Get(handle);
+    return sound != nullptr && sound->frameCount > 0;
+}
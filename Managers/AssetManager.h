@@ -1,7 +1,47 @@
 #pragma once
 #include "raylib.h"
+#include "AssetHandle.h"
+#include "../Systems/AssetPack.h"
+#include <atomic>
 #include <map>
 #include <string>
+#include <thread>
+#include <vector>
+
+// 📦 Pack semua aset (Tools/AssetPacker). Gak ada = fallback baca file lepas satu-satu
+#define ASSET_PACK_PATH "Resources/assets.mbpk"
+
+// 📦 1 aset yang diload. Worker thread ngerjain bagian CPU (baca file, decode, sintesis),
+// main thread ngerjain bagian GPU / audio device (upload texture / mesh, bikin Sound / Music).
+enum class AssetJobType {
+    MODEL_FILE,       // .glb: worker baca byte, main parse + upload (raylib LoadModel gak bisa dipisah)
+    MODEL_PROCEDURAL, // Mesh "mesh/<nama>" dari pack (worker copy array), fallback GenMesh* di main
+    TEXTURE,          // Worker decode PNG -> Image, main LoadTextureFromImage
+    MUSIC,            // Worker baca byte mp3, main LoadMusicStreamFromMemory (byte-nya disimpan)
+    SOUND_FILE,       // Worker decode mp3 -> Wave, main LoadSoundFromWave
+    SOUND_PROCEDURAL  // Worker ambil Wave AudioGenerator (cache disk / sintesis), main LoadSoundFromWave
+};
+
+struct AssetJob {
+    AssetJobType type;
+    std::string name;
+    std::string path;             // Path file lepas = nama entry di pack
+    float volume = 1.0f;
+    Mesh (*makeMesh)() = nullptr; // MODEL_PROCEDURAL, atau fallback MODEL_FILE kalau file gak ada
+    int waveType = 0;             // SOUND_PROCEDURAL
+    float frequency = 0.0f;
+    float duration = 0.0f;
+
+    // Hasil worker (dipakai main thread pas upload)
+    Image image = { 0 };
+    Wave wave = { 0 };
+    unsigned char* fileData = nullptr;
+    int fileSize = 0;
+    const unsigned char* borrowedData = nullptr; // MUSIC langsung dari mmap pack (bukan milik job)
+    Mesh mesh = { 0 };                           // MODEL_PROCEDURAL dari pack (array CPU, belum upload)
+    bool fromPack = false;
+    bool fromCache = false;                      // SOUND_PROCEDURAL dari cache PCM AudioGenerator
+};
 
 class AssetManager {
 public:
@@ -9,21 +49,62 @@ public:
     ~AssetManager();
 
     // Fungsi Load Massal
-    void LoadAll();
+    void LoadAll(); // Sinkron (nunggu async selesai di tempat)
     void UnloadAll();
 
-    // Getter untuk Model & Texture
-    Model& GetModel(const std::string& name);
-    Texture2D& GetTexture(const std::string& name);
-    Music& GetMusic(const std::string& name);
-    Sound& GetSound(const std::string& name);
-    // Di dalam class AssetManager { public: ... }
-    bool IsSoundReady(std::string name);
+    // ⏳ Load async: BeginAsyncLoad sekali, lalu PumpAsyncLoad tiap frame sampai return true.
+    // Pump cuma upload hasil worker selama budgetSeconds (minimal 1 aset per panggilan).
+    void BeginAsyncLoad();
+    bool PumpAsyncLoad(double budgetSeconds);
+    float GetLoadProgress() const; // 0..1 (kerjaan worker + upload main)
+    const char* GetLoadingLabel() const; // Nama aset yang lagi diproses (buat UI)
+    bool IsLoaded() const { return mLoaded; }
+
+    // Daftar semua aset (dipakai loader & Tools/AssetPacker biar isi pack selalu sama)
+    static void BuildJobList(std::vector<AssetJob>& jobs);
+
+    // 🔑 Resolve nama -> handle (sekali, setelah load selesai). Gak ketemu = handle invalid
+    ModelHandle FindModel(const std::string& name) const { return mModels.Find(name); }
+    TextureHandle FindTexture(const std::string& name) const { return mTextures.Find(name); }
+    MusicHandle FindMusic(const std::string& name) const { return mMusics.Find(name); }
+    SoundHandle FindSound(const std::string& name) const { return mSounds.Find(name); }
+
+    // Getter via handle (O(1), buat hot path). Invalid / basi -> fallback sama kayak getter nama
+    Model& GetModel(ModelHandle handle);
+    Texture2D& GetTexture(TextureHandle handle);
+    Music& GetMusic(MusicHandle handle);
+    Sound& GetSound(SoundHandle handle);
+    bool IsSoundReady(SoundHandle handle);
+
+    // Getter via nama (setup / tooling; tiap panggil = lookup map)
+    Model& GetModel(const std::string& name) { return GetModel(FindModel(name)); }
+    Texture2D& GetTexture(const std::string& name) { return GetTexture(FindTexture(name)); }
+    Music& GetMusic(const std::string& name) { return GetMusic(FindMusic(name)); }
+    Sound& GetSound(const std::string& name) { return GetSound(FindSound(name)); }
+    bool IsSoundReady(const std::string& name) { return IsSoundReady(FindSound(name)); }
 
 
 private:
-    std::map<std::string, Model> mModels;
-    std::map<std::string, Texture2D> mTextures;
-    std::map<std::string, Music> mMusics;
-    std::map<std::string, Sound> mSounds;
-};
\ No newline at end of file
+    AssetTable<Model> mModels;
+    AssetTable<Texture2D> mTextures;
+    AssetTable<Music> mMusics;
+    AssetTable<Sound> mSounds;
+    std::map<std::string, unsigned char*> mMusicData; // Music stream baca dari sini terus, jangan di-free duluan
+
+    // --- ASYNC ---
+    void WorkerMain();                 // Worker thread: bagian CPU semua job, urut
+    void LoadJobCpu(AssetJob& job) const;
+    unsigned char* ReadAssetBytes(AssetJob& job, const unsigned char** outData, int* outSize) const;
+    void UploadJob(AssetJob& job);     // Main thread
+    static void FreeJobPayload(AssetJob& job);
+    void StopWorker();
+
+    AssetPackView mPack;           // Di-mmap selama aset hidup (music stream bisa baca langsung dari sini)
+    std::vector<AssetJob> mJobs;
+    std::thread mWorker;
+    std::atomic<int> mCpuReady;    // Job [0, mCpuReady) udah beres di worker (release/acquire)
+    std::atomic<bool> mCancel;
+    int mNextUpload;               // Job berikutnya yang di-upload main thread
+    bool mLoading;
+    bool mLoaded;
+};
@@ -1,83 +1,250 @@
 #include "AudioGenerator.h"
 #include <math.h>
-#include <stdlib.h> // malloc/free
-#include <algorithm> // min/max
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <filesystem>
 
 // --- BAGIAN 1: DAPUR MATEMATIKA (HELPER) ---
 
-// 0 = Square (Laser), 1 = Noise (Ledakan/Telur), 2 = Sine (Gem)
-Wave GenerateRawWave(int type, int sampleRate, float frequency) {
-    Wave wave = { 0 };
-    wave.sampleRate = sampleRate;
-    wave.sampleSize = 32; 
-    wave.channels = 1;    
-    wave.frameCount = sampleRate; // Default buffer 1 detik
-    
-    float *data = (float *)malloc(wave.frameCount * sizeof(float));
-
-    for (unsigned int i = 0; i < wave.frameCount; i++) {
-        float t = (float)i / sampleRate;
-        
-        if (type == 0) { // SQUARE
-            if (sinf(2.0f * PI * frequency * t) >= 0) data[i] = 0.3f;
-            else data[i] = -0.3f;
+static const int SAMPLE_RATE = 44100;
+
+// Naikin angka ini kalau rumus kernel di bawah berubah -> semua cache lama otomatis dianggap basi
+static const uint32_t SOUND_KERNEL_VERSION = 2;
+static const uint32_t SOUND_CACHE_MAGIC = 0x4353424D; // "MBSC"
+
+// Fase integer 32 bit: 1 putaran = 2^32, overflow = wrap gratis (gak ada fmod / drift float)
+static uint32_t PhaseIncrement(float frequency) {
+    double cycles = (double)frequency / SAMPLE_RATE;
+    cycles -= floor(cycles);
+    return (uint32_t)(cycles * 4294967296.0);
+}
+
+// Hash integer (lowbias32): noise per index, gak ada state berantai kayak rand()
+static inline uint32_t HashNoise(uint32_t x) {
+    x ^= x >> 16;
+    x *= 0x7FEB352Du;
+    x ^= x >> 15;
+    x *= 0x846CA68Bu;
+    x ^= x >> 16;
+    return x;
+}
+
+// sin() dari fase integer: lipat ke [-pi/2, pi/2] lalu polinom derajat 9 (error < 4e-6).
+// Lipatnya pakai mask integer (bukan if) biar loop-nya tetap bisa SIMD:
+// |fase| > 1/4 putaran -> fase = 1/2 putaran - fase (sama-sama wrap 2^32 buat sisi positif & negatif)
+static inline float SinFromPhase(uint32_t phase) {
+    uint32_t mask = (uint32_t)((int32_t)(phase + 0x40000000u) >> 31);
+    uint32_t folded = (phase & ~mask) | ((0x80000000u - phase) & mask);
+    float x = (float)(int32_t)folded * (float)(PI / 2147483648.0);
+    float x2 = x * x;
+    return x * (1.0f + x2 * (-1.0f / 6.0f + x2 * (1.0f / 120.0f + x2 * (-1.0f / 5040.0f + x2 * (1.0f / 362880.0f)))));
+}
+
+// Sample diproses per blok KERNEL_LANES: loop dalam panjangnya konstan -> compiler jadiin SIMD
+// (SSE / NEON) walau di -O2. Buffer wave dibulatin ke atas kelipatan KERNEL_LANES.
+static const int KERNEL_LANES = 8;
+
+static int PaddedFrames(int frames) {
+    return (frames + KERNEL_LANES - 1) / KERNEL_LANES * KERNEL_LANES;
+}
+
+// Tiap sample cuma fungsi dari index-nya (tanpa sinf / rand / dependensi antar sample).
+// Fade out langsung dikali di sini. data harus muat PaddedFrames(frames)
+static void CookSquare(float* data, int frames, uint32_t inc) {
+    const float invFrames = 1.0f / (float)frames;
+    for (int base = 0; base < PaddedFrames(frames); base += KERNEL_LANES) {
+        for (int lane = 0; lane < KERNEL_LANES; lane++) {
+            uint32_t i = (uint32_t)(base + lane);
+            // Setengah putaran pertama (sin >= 0) = +0.3
+            float sample = ((i * inc) & 0x80000000u) ? -0.3f : 0.3f;
+            data[base + lane] = sample * (1.0f - (float)(int)i * invFrames);
         }
-        else if (type == 1) { // NOISE
-            data[i] = ((float)rand() / RAND_MAX * 1.0f) - 0.5f;
-            data[i] *= 0.5f; 
+    }
+}
+
+static void CookNoise(float* data, int frames, uint32_t seed) {
+    const float invFrames = 1.0f / (float)frames;
+    for (int base = 0; base < PaddedFrames(frames); base += KERNEL_LANES) {
+        for (int lane = 0; lane < KERNEL_LANES; lane++) {
+            uint32_t i = (uint32_t)(base + lane);
+            // [-0.25, 0.25] (sama kayak (rand()/RAND_MAX - 0.5) * 0.5 dulu)
+            float u = (float)(int)(HashNoise(i ^ seed) >> 8) * (1.0f / 16777216.0f);
+            data[base + lane] = (u - 0.5f) * 0.5f * (1.0f - (float)(int)i * invFrames);
         }
-        else { // SINE
-            data[i] = sinf(2.0f * PI * frequency * t) * 0.5f;
+    }
+}
+
+static void CookSine(float* data, int frames, uint32_t inc) {
+    const float invFrames = 1.0f / (float)frames;
+    for (int base = 0; base < PaddedFrames(frames); base += KERNEL_LANES) {
+        for (int lane = 0; lane < KERNEL_LANES; lane++) {
+            uint32_t i = (uint32_t)(base + lane);
+            data[base + lane] = SinFromPhase(i * inc) * 0.5f * (1.0f - (float)(int)i * invFrames);
         }
     }
+}
+
+// 0 = Square (Laser), 1 = Noise (Ledakan/Telur), 2 = Sine (Gem)
+static void CookSamples(float* data, int frames, int type, float frequency, uint32_t seed) {
+    if (type == 0) CookSquare(data, frames, PhaseIncrement(frequency));
+    else if (type == 1) CookNoise(data, frames, seed);
+    else CookSine(data, frames, PhaseIncrement(frequency));
+}
+
+static int TargetFrames(float duration) {
+    int frames = (int)(SAMPLE_RATE * duration);
+    return frames > 0 ? frames : 1;
+}
+
+// FNV-1a 64 dari semua yang ngaruh ke hasil -> kunci cache
+static uint64_t RecipeKey(int type, float frequency, float duration) {
+    uint32_t words[5];
+    words[0] = (uint32_t)type;
+    memcpy(&words[1], &frequency, sizeof(float));
+    memcpy(&words[2], &duration, sizeof(float));
+    words[3] = (uint32_t)SAMPLE_RATE;
+    words[4] = SOUND_KERNEL_VERSION;
+
+    uint64_t hash = 1469598103934665603ull;
+    const unsigned char* bytes = (const unsigned char*)words;
+    for (size_t i = 0; i < sizeof(words); i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+// Masak Wave (cuma CPU, belum jadi Sound) -> aman dipanggil dari worker thread
+// Buffer langsung seukuran durasi, gak alokasi 1 detik lalu dipotong
+Wave AudioGenerator::CreateProceduralWave(int type, float freq, float duration) {
+    Wave wave = { 0 };
+    wave.sampleRate = SAMPLE_RATE;
+    wave.sampleSize = 32;
+    wave.channels = 1;
+    wave.frameCount = (unsigned int)TargetFrames(duration);
+
+    float* data = (float*)MemAlloc((unsigned int)(PaddedFrames((int)wave.frameCount) * sizeof(float)));
+    CookSamples(data, (int)wave.frameCount, type, freq, (uint32_t)RecipeKey(type, freq, duration));
     wave.data = data;
     return wave;
 }
 
-// Fungsi Pintar: Masak Wave -> Potong -> Fade Out -> Jadi Sound
-Sound CreateProceduralSound(int type, float freq, float duration) {
-    int sampleRate = 44100;
-    Wave wave = GenerateRawWave(type, sampleRate, freq);
-    
-    // 1. POTONG DURASI
-    int targetFrames = (int)(sampleRate * duration);
-    if (targetFrames < wave.frameCount) wave.frameCount = targetFrames;
-    
-    // 2. FADE OUT (Otomatis biar gak kasar)
-    float* data = (float*)wave.data;
-    for (unsigned int i = 0; i < wave.frameCount; i++) {
-        float progress = (float)i / wave.frameCount;
-        data[i] *= (1.0f - progress); 
+// --- CACHE DISK ---
+// 1 file per resep: header + PCM float mentah. Nama file ikut kunci -> resep diubah = file baru
+
+struct SoundCacheHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t key;
+    int32_t sampleRate;
+    int32_t frameCount;
+};
+
+static std::string CachePath(const char* name, uint64_t key) {
+    char file[64];
+    snprintf(file, sizeof(file), "_%016llx.pcm", (unsigned long long)key);
+    return std::string(SOUND_CACHE_DIR) + "/" + name + file;
+}
+
+static bool ReadCachedWave(const std::string& path, uint64_t key, int frames, Wave& out) {
+    FILE* file = fopen(path.c_str(), "rb");
+    if (file == nullptr) return false;
+
+    SoundCacheHeader header;
+    bool ok = fread(&header, sizeof(header), 1, file) == 1
+        && header.magic == SOUND_CACHE_MAGIC
+        && header.version == SOUND_KERNEL_VERSION
+        && header.key == key
+        && header.sampleRate == SAMPLE_RATE
+        && header.frameCount == frames;
+
+    float* data = nullptr;
+    if (ok) {
+        data = (float*)MemAlloc((unsigned int)(frames * sizeof(float)));
+        ok = fread(data, sizeof(float), (size_t)frames, file) == (size_t)frames;
+    }
+    fclose(file);
+
+    if (!ok) {
+        MemFree(data);
+        return false;
     }
-    
-    // 3. PACKING
-    Sound sfx = LoadSoundFromWave(wave);
-    UnloadWave(wave); // Cuci piring
-    return sfx;
+    out = Wave{ 0 };
+    out.sampleRate = SAMPLE_RATE;
+    out.sampleSize = 32;
+    out.channels = 1;
+    out.frameCount = (unsigned int)frames;
+    out.data = data;
+    return true;
 }
 
+// Tulis ke .tmp lalu rename: 2 instance game barengan gak bakal baca file setengah jadi
+static void WriteCachedWave(const std::string& path, uint64_t key, const Wave& wave) {
+    std::error_code error;
+    std::filesystem::create_directories(SOUND_CACHE_DIR, error);
+
+    std::string tempPath = path + ".tmp";
+    FILE* file = fopen(tempPath.c_str(), "wb");
+    if (file == nullptr) return;
+
+    SoundCacheHeader header = { SOUND_CACHE_MAGIC, SOUND_KERNEL_VERSION, key, SAMPLE_RATE, (int32_t)wave.frameCount };
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1
+        && fwrite(wave.data, sizeof(float), wave.frameCount, file) == wave.frameCount;
+    ok = (fclose(file) == 0) && ok;
+
+    if (ok) std::filesystem::rename(tempPath, path, error);
+    if (!ok || error) std::filesystem::remove(tempPath, error);
+}
+
+Wave AudioGenerator::LoadCachedWave(const SoundRecipe& recipe, bool* outCacheHit) {
+    uint64_t key = RecipeKey(recipe.type, recipe.frequency, recipe.duration);
+    std::string path = CachePath(recipe.name, key);
+
+    Wave wave = { 0 };
+    bool hit = ReadCachedWave(path, key, TargetFrames(recipe.duration), wave);
+    if (!hit) {
+        wave = CreateProceduralWave(recipe.type, recipe.frequency, recipe.duration);
+        WriteCachedWave(path, key, wave); // Gagal nulis (folder read-only) = gak apa-apa, masak lagi next launch
+    }
+    if (outCacheHit != nullptr) *outCacheHit = hit;
+    return wave;
+}
 
 // --- BAGIAN 2: DAFTAR RESEP (MENU) ---
 
-void AudioGenerator::GenerateAllSounds(std::map<std::string, Sound>& soundMap) {
-    
-    // FORMAT: CreateProceduralSound(TIPE, FREKUENSI, DURASI)
-    // Tipe: 0=Laser, 1=Noise, 2=Sine
-    
+// FORMAT: { NAMA, TIPE, FREKUENSI, DURASI }
+// Tipe: 0=Laser, 1=Noise, 2=Sine
+static const AudioGenerator::SoundRecipe SOUND_RECIPES[] = {
     // 🥚 Telur Pecah (Noise, 0 Hz, 0.05 detik)
-    soundMap["egg_break"] = CreateProceduralSound(1, 0.0f, 0.20f);
+    { "egg_break", 1, 0.0f, 0.20f },
 
     // 💥 Ledakan (Noise, 0 Hz, 0.5 detik)
-    soundMap["explosion"] = CreateProceduralSound(1, 0.0f, 0.5f);
+    { "explosion", 1, 0.0f, 0.5f },
 
     // 🔫 Laser (Square, 400 Hz, 0.15 detik)
-    soundMap["laser"] = CreateProceduralSound(0, 400.0f, 0.15f);
+    { "laser", 0, 400.0f, 0.15f },
 
     // ✨ Gem/XP (Sine, 880 Hz, 0.2 detik)
-    soundMap["gem"] = CreateProceduralSound(2, 880.0f, 0.2f);
-    
+    { "gem", 2, 880.0f, 0.2f },
+
     // Mau nambah baru? Tinggal copas satu baris di bawah ini:
-    // soundMap["powerup"] = CreateProceduralSound(0, 600.0f, 0.5f); 
+    // { "powerup", 0, 600.0f, 0.5f },
+};
+
+const AudioGenerator::SoundRecipe* AudioGenerator::GetRecipes(int& outCount) {
+    outCount = (int)(sizeof(SOUND_RECIPES) / sizeof(SOUND_RECIPES[0]));
+    return SOUND_RECIPES;
+}
+
+void AudioGenerator::GenerateAllSounds(std::map<std::string, Sound>& soundMap) {
+    int count = 0;
+    const SoundRecipe* recipes = GetRecipes(count);
+    for (int i = 0; i < count; i++) {
+        Wave wave = LoadCachedWave(recipes[i]);
+        soundMap[recipes[i].name] = LoadSoundFromWave(wave); // Butuh audio device, main thread
+        UnloadWave(wave); // Cuci piring
+    }
 
     TraceLog(LOG_INFO, "🔊 AUDIO GENERATOR: All procedural sounds cooked successfully!");
-}
\ No newline at end of file
+}
@@ -3,7 +3,28 @@
 #include <map>
 #include <string>
 
+// Folder cache PCM hasil masak (aman dihapus, dibikin ulang otomatis)
+#define SOUND_CACHE_DIR "Cache/sfx"
+
 namespace AudioGenerator {
-    // Fungsi utama yang dipanggil AssetManager
+    // 1 resep SFX procedural. Tipe: 0=Laser (Square), 1=Noise, 2=Sine
+    struct SoundRecipe {
+        const char* name;
+        int type;
+        float frequency;
+        float duration;
+    };
+
+    // Daftar resep (dipakai loader async: sintesis di worker thread, upload di main thread)
+    const SoundRecipe* GetRecipes(int& outCount);
+
+    // Cuma CPU (gak nyentuh audio device) -> aman dipanggil dari worker thread
+    Wave CreateProceduralWave(int type, float freq, float duration);
+
+    // Sama, tapi baca PCM matang dari SOUND_CACHE_DIR kalau ada (kunci = parameter resep).
+    // Cache miss = masak + simpan buat launch berikutnya. Juga aman dari worker thread
+    Wave LoadCachedWave(const SoundRecipe& recipe, bool* outCacheHit = nullptr);
+
+    // Versi sinkron lama: semua resep langsung jadi Sound
     void GenerateAllSounds(std::map<std::string, Sound>& soundMap);
 }
\ No newline at end of file
@@ -0,0 +1,142 @@
+#include "FrameProfiler.h"
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+
+FrameProfiler::FrameProfiler() : mShowOverlay(false) {
+    Reset();
+}
+
+void FrameProfiler::Reset() {
+    for (auto& h : mHistory) {
+        h.count = 0;
+        h.head = 0;
+    }
+    for (int& c : mCounters) c = 0;
+}
+
+void FrameProfiler::AddSample(ProfPhase phase, double ms) {
+    PhaseHistory& h = mHistory[(int)phase];
+    h.samples[h.head] = ms;
+    h.head = (h.head + 1) % HISTORY_SIZE;
+    if (h.count < HISTORY_SIZE) h.count++;
+}
+
+PhaseStats FrameProfiler::GetStats(ProfPhase phase) const {
+    const PhaseHistory& h = mHistory[(int)phase];
+    PhaseStats stats = { 0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+    if (h.count == 0) return stats;
+
+    // Copy sample yang valid biar bisa di-sort buat p99
+    std::vector<double> sorted(h.samples, h.samples + h.count);
+    std::sort(sorted.begin(), sorted.end());
+
+    double sum = 0.0;
+    for (double v : sorted) sum += v;
+
+    int p99Index = (int)((h.count - 1) * 0.99);
+
+    stats.samples = h.count;
+    stats.lastMs = h.samples[(h.head + HISTORY_SIZE - 1) % HISTORY_SIZE];
+    stats.minMs = sorted.front();
+    stats.avgMs = sum / h.count;
+    stats.p99Ms = sorted[p99Index];
+    stats.maxMs = sorted.back();
+    return stats;
+}
+
+const char* FrameProfiler::GetPhaseName(ProfPhase phase) {
+    switch (phase) {
+        case ProfPhase::UPDATE_TOTAL:         return "Update (total)";
+        case ProfPhase::UPDATE_A_MOVEMENT:    return "A Movement";
+        case ProfPhase::UPDATE_B_MANAGERS:    return "B Managers";
+        case ProfPhase::UPDATE_C_INPUT:       return "C Shoot/Dash";
+        case ProfPhase::UPDATE_D_CAMERA:      return "D Camera";
+        case ProfPhase::UPDATE_E_WAVES:       return "E Waves";
+        case ProfPhase::UPDATE_F_ENEMY_LOGIC: return "F Enemy Logic";
+        case ProfPhase::UPDATE_F_SEPARATION:  return "F Separation";
+        case ProfPhase::UPDATE_G_ENEMY_PROJ:  return "G Enemy Proj";
+        case ProfPhase::UPDATE_H_PLAYER_PROJ: return "H Player Proj";
+        case ProfPhase::UPDATE_I_GEMS:        return "I Gems";
+        case ProfPhase::UPDATE_J_ITEMS:       return "J Items";
+        case ProfPhase::UPDATE_K_CLEANUP:     return "K Cleanup";
+        case ProfPhase::DRAW_TOTAL:           return "Draw (total)";
+        case ProfPhase::DRAW_WORLD:           return "Draw World";
+        case ProfPhase::DRAW_ENEMIES:         return "Draw Enemies";
+        case ProfPhase::DRAW_PARTICLES:       return "Draw Particles";
+        case ProfPhase::DRAW_GEMS:            return "Draw Gems";
+        case ProfPhase::DRAW_UI:              return "Draw UI";
+        default:                              return "?";
+    }
+}
+
+const char* FrameProfiler::GetCounterName(ProfCounter counter) {
+    switch (counter) {
+        case ProfCounter::ENEMY_DRAW_CALLS: return "Enemy draw calls";
+        case ProfCounter::ENEMY_INSTANCES:  return "Enemy instances";
+        case ProfCounter::SHADOW_CASTERS:   return "Shadow casters";
+        case ProfCounter::GEM_INSTANCES:    return "Gem instances";
+        case ProfCounter::PARTICLE_INSTANCES: return "Particles";
+        case ProfCounter::SFX_VOICES:       return "SFX voices";
+        default:                            return "?";
+    }
+}
+
+void FrameProfiler::DrawOverlay(int x, int y) const {
+    const int rowH = 12;
+    const int fontSize = 10;
+    int rows = (int)ProfPhase::COUNT + (int)ProfCounter::COUNT + 1;
+
+    DrawRectangle(x - 5, y - 5, 330, rows * rowH + 10, (Color){ 0, 0, 0, 180 });
+    DrawText("PHASE              LAST    MIN    AVG    P99  (ms)", x, y, fontSize, YELLOW);
+
+    for (int i = 0; i < (int)ProfPhase::COUNT; i++) {
+        ProfPhase phase = (ProfPhase)i;
+        PhaseStats s = GetStats(phase);
+        int rowY = y + (i + 1) * rowH;
+
+        // Warna merah kalau p99 fase ini makan > 1/4 budget 16 ms
+        Color c = (s.p99Ms > 4.0) ? RED : WHITE;
+        if (phase == ProfPhase::UPDATE_TOTAL || phase == ProfPhase::DRAW_TOTAL) c = (s.p99Ms > 16.0) ? RED : SKYBLUE;
+
+        DrawText(GetPhaseName(phase), x, rowY, fontSize, c);
+        DrawText(TextFormat("%6.2f %6.2f %6.2f %6.2f", s.lastMs, s.minMs, s.avgMs, s.p99Ms), x + 120, rowY, fontSize, c);
+    }
+
+    // Counter (frame terakhir) di bawah tabel fase
+    for (int i = 0; i < (int)ProfCounter::COUNT; i++) {
+        int rowY = y + ((int)ProfPhase::COUNT + 1 + i) * rowH;
+        DrawText(GetCounterName((ProfCounter)i), x, rowY, fontSize, GREEN);
+        DrawText(TextFormat("%6d", mCounters[i]), x + 120, rowY, fontSize, GREEN);
+    }
+}
+
+bool FrameProfiler::DumpCSV(const char* path) const {
+    FILE* f = fopen(path, "w");
+    if (!f) {
+        std::cout << "❌ PROFILER: Gagal nulis CSV " << path << std::endl;
+        return false;
+    }
+
+    fprintf(f, "phase,samples,last_ms,min_ms,avg_ms,p99_ms,max_ms\n");
+    for (int i = 0; i < (int)ProfPhase::COUNT; i++) {
+        PhaseStats s = GetStats((ProfPhase)i);
+        fprintf(f, "%s,%d,%.4f,%.4f,%.4f,%.4f,%.4f\n", GetPhaseName((ProfPhase)i),
+                s.samples, s.lastMs, s.minMs, s.avgMs, s.p99Ms, s.maxMs);
+    }
+    fclose(f);
+
+    std::cout << "📊 PROFILER: CSV disimpan ke " << path << std::endl;
+    return true;
+}
+
+void FrameProfiler::PrintTable() const {
+    printf("%-16s %7s %8s %8s %8s %8s\n", "PHASE", "SAMPLES", "MIN", "AVG", "P99", "MAX");
+    for (int i = 0; i < (int)ProfPhase::COUNT; i++) {
+        PhaseStats s = GetStats((ProfPhase)i);
+        if (s.samples == 0) continue;
+        printf("%-16s %7d %8.4f %8.4f %8.4f %8.4f\n", GetPhaseName((ProfPhase)i),
+               s.samples, s.minMs, s.avgMs, s.p99Ms, s.maxMs);
+    }
+    fflush(stdout);
+}
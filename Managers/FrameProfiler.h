@@ -0,0 +1,165 @@
+#pragma once
+#include "raylib.h"
+#include <chrono>
+#include <vector>
+
+// ⏱️ FRAME PROFILER
+// Timer per section Game::Update (A-K) & per phase Game::Draw.
+// Tiap fase nyimpen N sample terakhir -> tabel min/avg/p99 (overlay F3 / CSV F4).
+// Build release (make RELEASE=1 -> NDEBUG) bikin semua macro PROFILE_* (timer + counter) jadi kosong
+// dan ring buffer sample-nya nyusut ke 1 slot. Overlay F3 tetap bisa dibuka, isinya kosong.
+
+#ifndef MEGABONK_PROFILER
+    #ifdef NDEBUG
+        #define MEGABONK_PROFILER 0
+    #else
+        #define MEGABONK_PROFILER 1
+    #endif
+#endif
+
+enum class ProfPhase {
+    // --- UPDATE (per tick simulasi) ---
+    UPDATE_TOTAL,
+    UPDATE_A_MOVEMENT,      // Player movement & map collision
+    UPDATE_B_MANAGERS,      // Projectile / Particle / Item update
+    UPDATE_C_INPUT,         // Shooting & dash
+    UPDATE_D_CAMERA,
+    UPDATE_E_WAVES,
+    UPDATE_F_ENEMY_LOGIC,
+    UPDATE_F_SEPARATION,    // Crowd separation (batch, abis logic musuh)
+    UPDATE_G_ENEMY_PROJ,    // Peluru musuh vs player
+    UPDATE_H_PLAYER_PROJ,   // Peluru player vs musuh
+    UPDATE_I_GEMS,
+    UPDATE_J_ITEMS,
+    UPDATE_K_CLEANUP,
+
+    // --- DRAW (per frame) ---
+    DRAW_TOTAL,
+    DRAW_WORLD,             // Level, ground, player
+    DRAW_ENEMIES,
+    DRAW_PARTICLES,         // Projectiles, particles, items
+    DRAW_GEMS,
+    DRAW_UI,                // Phase 2 (HUD / menu / present)
+
+    COUNT
+};
+
+// Angka per frame (bukan waktu) yang ikut nongol di overlay, di-set langsung sama pemanggil
+enum class ProfCounter {
+    ENEMY_DRAW_CALLS,       // Draw call mesh musuh (body + shadow)
+    ENEMY_INSTANCES,        // Body musuh yang lewat DrawMeshInstanced
+    SHADOW_CASTERS,         // Blob shadow di ShadowBatch (1 draw call semua)
+    GEM_INSTANCES,          // XP gem di 1 DrawMeshInstanced
+    PARTICLE_INSTANCES,     // Partikel hidup (instanced = 1 draw call, fallback = 1 DrawCube/partikel)
+    SFX_VOICES,             // Alias SoundVoicePool yang lagi bunyi
+
+    COUNT
+};
+
+struct PhaseStats {
+    int samples;
+    double lastMs;
+    double minMs;
+    double avgMs;
+    double p99Ms;
+    double maxMs;
+};
+
+class FrameProfiler {
+public:
+    static constexpr int HISTORY_SIZE = MEGABONK_PROFILER ? 600 : 1; // ~10 detik @ 60 Hz
+
+    FrameProfiler();
+
+    void AddSample(ProfPhase phase, double ms);
+    void SetCounter(ProfCounter counter, int value) { mCounters[(int)counter] = value; }
+    int GetCounter(ProfCounter counter) const { return mCounters[(int)counter]; }
+    PhaseStats GetStats(ProfPhase phase) const;
+    void Reset();
+
+    void ToggleOverlay() { mShowOverlay = !mShowOverlay; }
+    bool IsOverlayVisible() const { return mShowOverlay; }
+
+    void DrawOverlay(int x, int y) const;
+    bool DumpCSV(const char* path) const;
+    void PrintTable() const; // Ke stdout (headless)
+
+    static const char* GetPhaseName(ProfPhase phase);
+    static const char* GetCounterName(ProfCounter counter);
+
+private:
+    struct PhaseHistory {
+        double samples[HISTORY_SIZE];
+        int count; // Total sample yang pernah masuk (dipotong ke HISTORY_SIZE)
+        int head;  // Index tulis berikutnya (ring buffer)
+    };
+
+    PhaseHistory mHistory[(int)ProfPhase::COUNT];
+    int mCounters[(int)ProfCounter::COUNT];
+    bool mShowOverlay;
+};
+
+// --- SCOPED TIMER: ukur dari konstruksi sampai keluar scope ---
+class ScopedPhaseTimer {
+public:
+    ScopedPhaseTimer(FrameProfiler& profiler, ProfPhase phase)
+        : mProfiler(profiler), mPhase(phase), mStart(std::chrono::steady_clock::now()) {}
+
+    ~ScopedPhaseTimer() {
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - mStart;
+        mProfiler.AddSample(mPhase, elapsed.count());
+    }
+
+private:
+    FrameProfiler& mProfiler;
+    ProfPhase mPhase;
+    std::chrono::steady_clock::time_point mStart;
+};
+
+// --- LAP TIMER: buat section berurutan tanpa kurung kurawal (A -> B -> C ...) ---
+// Next() nutup fase sebelumnya & mulai fase baru. Fase terakhir ditutup di destructor,
+// jadi early return di tengah Update tetap kecatat.
+class PhaseLapTimer {
+public:
+    explicit PhaseLapTimer(FrameProfiler& profiler)
+        : mProfiler(profiler), mPhase(ProfPhase::COUNT) {}
+
+    ~PhaseLapTimer() { Stop(); }
+
+    void Next(ProfPhase phase) {
+        auto now = std::chrono::steady_clock::now();
+        Close(now);
+        mPhase = phase;
+        mStart = now;
+    }
+
+    void Stop() { Close(std::chrono::steady_clock::now()); mPhase = ProfPhase::COUNT; }
+
+private:
+    void Close(std::chrono::steady_clock::time_point now) {
+        if (mPhase == ProfPhase::COUNT) return;
+        std::chrono::duration<double, std::milli> elapsed = now - mStart;
+        mProfiler.AddSample(mPhase, elapsed.count());
+    }
+
+    FrameProfiler& mProfiler;
+    ProfPhase mPhase;
+    std::chrono::steady_clock::time_point mStart;
+};
+
+#define PROF_CONCAT_INNER(a, b) a##b
+#define PROF_CONCAT(a, b) PROF_CONCAT_INNER(a, b)
+
+#if MEGABONK_PROFILER
+    #define PROFILE_SCOPE(profiler, phase) ScopedPhaseTimer PROF_CONCAT(_profScope, __LINE__)((profiler), (phase))
+    #define PROFILE_LAP_BEGIN(profiler, lap) PhaseLapTimer lap((profiler))
+    #define PROFILE_LAP(lap, phase) (lap).Next((phase))
+    #define PROFILE_LAP_STOP(lap) (lap).Stop()
+    #define PROFILE_COUNTER(profiler, counter, value) (profiler).SetCounter((counter), (value))
+#else
+    #define PROFILE_SCOPE(profiler, phase) ((void)0)
+    #define PROFILE_LAP_BEGIN(profiler, lap) ((void)0)
+    #define PROFILE_LAP(lap, phase) ((void)0)
+    #define PROFILE_LAP_STOP(lap) ((void)0)
+    #define PROFILE_COUNTER(profiler, counter, value) ((void)0) // value gak dievaluasi
+#endif
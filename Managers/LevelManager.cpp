@@ -12,84 +12,198 @@ LevelManager::LevelManager() : mMapWidth(0), mMapHeight(0), mTileSize(2.0f) {
     mBreakableModel.materials[0].maps[MATERIAL_MAP_DIFFUSE].color = RED;
     
     mHasCollisionMap = false;
-    mCollisionPixels = nullptr;
+    mPlayerSpawn = { 0, 0, 0 };
+    mEnemySpawns = nullptr;
+    mEnemySpawnCount = 0;
     mHasMapTexture = false;
+    mCollisionVersion = 0;
 }
 
 LevelManager::~LevelManager() {
-    if (mHasCollisionMap) {
-        UnloadImageColors(mCollisionPixels);
-        UnloadImage(mCollisionMap);
-    }
+    UnloadCollisionMap();
+}
+
+void LevelManager::UnloadCollisionMap() {
     if (mHasMapTexture) {
         UnloadTexture(mMapTexture);
+        mHasMapTexture = false;
     }
+    mHasCollisionMap = false;
+    mSolidBits.Attach(nullptr, 0, 0);
+    mWaterBits.Attach(nullptr, 0, 0);
+    mBreakableBits.Attach(nullptr, 0, 0);
+    mWallField.Clear();
+    mPlayerSpawn = { 0, 0, 0 };
+    mEnemySpawns = nullptr;
+    mEnemySpawnCount = 0;
+    mLevelFile.Close(); // View di atas nunjuk ke sini, jadi ditutup paling akhir
+    mCompiled = LevelData();
 }
 
 void LevelManager::LoadCollisionMap(const char* imagePath) {
-    if (mHasCollisionMap) {
-        UnloadImageColors(mCollisionPixels);
-        UnloadImage(mCollisionMap);
+    UnloadCollisionMap();
+    mCollisionVersion++; // Flow field wajib rebuild
+
+    // "ground.png" -> "ground.mblv"
+    std::string levelPath = imagePath;
+    size_t dot = levelPath.find_last_of('.');
+    if (dot != std::string::npos) levelPath.erase(dot);
+    levelPath += ".mblv";
+
+    if (LoadLevelFile(levelPath.c_str(), imagePath)) {
+        std::cout << "🗺️ COLLISION MAP MAPPED: " << levelPath << " " << mMapWidth << "x" << mMapHeight;
+    } else if (LoadCollisionImage(imagePath)) {
+        std::cout << "🗺️ COLLISION MAP LOADED: " << imagePath << " " << mMapWidth << "x" << mMapHeight
+                  << " (compile di tempat, jalanin Tools/LevelCompiler biar gak decode PNG tiap load)";
+    } else {
+        std::cout << "❌ FAILED TO LOAD COLLISION MAP: " << imagePath << std::endl;
+        return;
     }
-    if (mHasMapTexture) {
-        UnloadTexture(mMapTexture);
-        mHasMapTexture = false;
+    mHasCollisionMap = true;
+    std::cout << " | solid bits " << mSolidBits.CountSet() << " (" << mSolidBits.ByteSize() / 1024 << " KB)"
+              << " | enemy spawns " << mEnemySpawnCount << std::endl;
+}
+
+bool LevelManager::LoadLevelFile(const char* levelPath, const char* imagePath) {
+    if (!FileExists(levelPath) || !mLevelFile.Open(levelPath)) return false;
+
+    // PNG-nya udah beda dari pas di-compile = .mblv basi, pakai PNG aja.
+    // PNG gak ada (build rilis cuma bawa .mblv) = percaya .mblv-nya.
+    if (FileExists(imagePath) && !(mLevelFile.Source() == StampLevelSource(imagePath))) {
+        std::cout << "⚠️ " << levelPath << " basi (" << imagePath << " berubah), jalanin Tools/LevelCompiler lagi" << std::endl;
+        mLevelFile.Close();
+        return false;
     }
 
-    mCollisionMap = LoadImage(imagePath);
-    if (mCollisionMap.data != nullptr) {
-        mCollisionPixels = LoadImageColors(mCollisionMap);
-        mHasCollisionMap = true;
-        
-        // Update dimensions
-        mMapWidth = mCollisionMap.width;
-        mMapHeight = mCollisionMap.height;
-
-        // Load Texture for Visualization
-        mMapTexture = LoadTextureFromImage(mCollisionMap);
+    // Semua layer langsung nunjuk ke halaman file, gak ada copy / parse
+    const LevelFileHeader& header = mLevelFile.Header();
+    mMapWidth = header.width;
+    mMapHeight = header.height;
+    mSolidBits.Attach(mLevelFile.Block<uint64_t>(header.solidBits), header.width, header.height);
+    mWaterBits.Attach(mLevelFile.Block<uint64_t>(header.waterBits), header.width, header.height);
+    mBreakableBits.Attach(mLevelFile.Block<uint64_t>(header.breakableBits), header.width, header.height);
+    mWallField.Attach(mLevelFile.Block<float>(header.distances), header.width, header.height, header.worldSize);
+    if (header.playerSpawns.count > 0) mPlayerSpawn = mLevelFile.Block<Vector3>(header.playerSpawns)[0];
+    mEnemySpawns = mLevelFile.Block<Vector3>(header.enemySpawns);
+    mEnemySpawnCount = (int)header.enemySpawns.count;
+
+    // Load Texture for Visualization (Skip kalau headless / belum ada GL context)
+    if (IsWindowReady()) {
+        Image view = { (void*)mLevelFile.Block<Color>(header.pixels), header.width, header.height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+        mMapTexture = LoadTextureFromImage(view); // Upload doang, Image-nya gak di-unload (punya mmap)
         SetTextureFilter(mMapTexture, TEXTURE_FILTER_POINT); // Pixelated look
         mHasMapTexture = true;
-        
-        std::cout << "🗺️ COLLISION MAP LOADED: " << mCollisionMap.width << "x" << mCollisionMap.height << std::endl;
-    } else {
-        std::cout << "❌ FAILED TO LOAD COLLISION MAP: " << imagePath << std::endl;
     }
+    return true;
+}
+
+bool LevelManager::LoadCollisionImage(const char* imagePath) {
+    Image image = LoadImage(imagePath);
+    if (image.data == nullptr) return false;
+
+    Color* pixels = LoadImageColors(image);
+    CompileLevelData(pixels, image.width, image.height, COLLISION_WORLD_SIZE, mCompiled);
+    UnloadImageColors(pixels);
+
+    mMapWidth = image.width;
+    mMapHeight = image.height;
+    mSolidBits.Attach(mCompiled.solid.Words(), image.width, image.height);
+    mWaterBits.Attach(mCompiled.water.Words(), image.width, image.height);
+    mBreakableBits.Attach(mCompiled.breakable.Words(), image.width, image.height);
+    mWallField.Attach(mCompiled.distances.Data(), image.width, image.height, COLLISION_WORLD_SIZE);
+    if (!mCompiled.playerSpawns.empty()) mPlayerSpawn = mCompiled.playerSpawns[0];
+    mEnemySpawns = mCompiled.enemySpawns.data();
+    mEnemySpawnCount = (int)mCompiled.enemySpawns.size();
+
+    if (IsWindowReady()) {
+        mMapTexture = LoadTextureFromImage(image);
+        SetTextureFilter(mMapTexture, TEXTURE_FILTER_POINT); // Pixelated look
+        mHasMapTexture = true;
+    }
+    UnloadImage(image);
+    return true;
+}
+
+bool LevelManager::WorldToPixel(Vector3 pos, int& outX, int& outY) const {
+    // Asumsi Plane 100x100 (dari -50 sampai 50)
+    // Map Image Koordinat: (0,0) di Top-Left, World (0,0) di tengah map image
+    float halfSize = COLLISION_WORLD_SIZE / 2.0f;
+    float u = (pos.x + halfSize) / COLLISION_WORLD_SIZE;
+    float v = (pos.z + halfSize) / COLLISION_WORLD_SIZE;
+
+    outX = (int)(u * mSolidBits.Width());
+    outY = (int)(v * mSolidBits.Height());
+    return outX >= 0 && outX < mSolidBits.Width() && outY >= 0 && outY < mSolidBits.Height();
 }
 
 bool LevelManager::IsPixelCollision(Vector3 pos, float radius) {
     if (!mHasCollisionMap) return false;
 
-    // Asumsi Plane 100x100 (dari -50 sampai 50)
-    // Map Image Koordinat: (0,0) di Top-Left
-    // World (0,0) di tengah map image
-    
-    // Mapping [-50, 50] -> [0, Width]
-    float mapSize = 100.0f; // Sesuai GenMeshPlane(100, 100)
-    float halfSize = mapSize / 2.0f;
-    
-    // Normalisasi (0.0 - 1.0)
-    float u = (pos.x + halfSize) / mapSize;
-    float v = (pos.z + halfSize) / mapSize;
-    
-    int tx = (int)(u * mCollisionMap.width);
-    int ty = (int)(v * mCollisionMap.height);
-    
     // Strict Boundary Check (Diluar Map = Tembok / Void)
-    // Jika koordinat pixel diluar range image, langsung return true (collision)
-    if (tx < 0 || tx >= mCollisionMap.width || ty < 0 || ty >= mCollisionMap.height) {
-        return true; 
-    }
+    int tx, ty;
+    if (!WorldToPixel(pos, tx, ty)) return true;
+    return mSolidBits.Test(tx, ty);
+}
+
+bool LevelManager::IsCircleBlocked(Vector3 pos, float radius) const {
+    if (!mHasCollisionMap) return false;
+    return mWallField.CircleBlocked(pos, radius);
+}
+
+float LevelManager::GetWallDistance(Vector3 pos) const {
+    if (!mHasCollisionMap) return COLLISION_WORLD_SIZE; // Gak ada map = gak ada tembok
+    return mWallField.Sample(pos);
+}
+
+Vector3 LevelManager::GetWallNormal(Vector3 pos) const {
+    if (!mHasCollisionMap) return { 0.0f, 0.0f, 0.0f };
+    return mWallField.Normal(pos);
+}
+
+Vector3 LevelManager::ResolveCircle(Vector3 pos, float radius) const {
+    if (!mHasCollisionMap) return pos;
+    return mWallField.PushOut(pos, radius);
+}
+
+bool LevelManager::IsWater(Vector3 pos) const {
+    int tx, ty;
+    if (!mHasCollisionMap || !WorldToPixel(pos, tx, ty)) return false;
+    return mWaterBits.Test(tx, ty);
+}
+
+bool LevelManager::IsBreakablePixel(Vector3 pos) const {
+    int tx, ty;
+    if (!mHasCollisionMap || !WorldToPixel(pos, tx, ty)) return false;
+    return mBreakableBits.Test(tx, ty);
+}
 
-    // Ambil warna pixel
-    Color c = mCollisionPixels[ty * mCollisionMap.width + tx];
+bool LevelManager::BuildBlockedGrid(int cells, std::vector<unsigned char>& outBlocked) const {
+    outBlocked.assign(cells * cells, 0);
+    if (!mHasCollisionMap) return false;
 
-    // Logika: Warna Gelap = Tembok / Void
-    // Misal: R,G,B < 80 dianggap tembok
-    if (c.r < 80 && c.g < 80 && c.b < 80) {
-        return true; 
+    // 1. Pixel solid (layer yang sama kayak IsPixelCollision) -> cell yang nampung pixel itu.
+    // Tiap cell = 1 kotak pixel, cukup 1 AnyInRect (word-level) per cell
+    int w = mSolidBits.Width();
+    int h = mSolidBits.Height();
+    for (int cy = 0; cy < cells; cy++) {
+        int py0 = (cy * h + cells - 1) / cells;
+        int py1 = ((cy + 1) * h + cells - 1) / cells - 1;
+        for (int cx = 0; cx < cells; cx++) {
+            int px0 = (cx * w + cells - 1) / cells;
+            int px1 = ((cx + 1) * w + cells - 1) / cells - 1;
+            if (mSolidBits.AnyInRect(px0, py0, px1, py1)) outBlocked[cy * cells + cx] = 1;
+        }
     }
-    
-    return false;
+
+    // 2. Tembok merah yang belum hancur juga ngeblok
+    float halfSize = COLLISION_WORLD_SIZE / 2.0f;
+    for (const auto& b : mBreakables) {
+        if (!b.active) continue;
+        int cx = (int)((b.position.x + halfSize) / COLLISION_WORLD_SIZE * cells);
+        int cy = (int)((b.position.z + halfSize) / COLLISION_WORLD_SIZE * cells);
+        if (cx >= 0 && cx < cells && cy >= 0 && cy < cells) outBlocked[cy * cells + cx] = 1;
+    }
+    return true;
 }
 
 void LevelManager::LoadLevelFromImage(const char* imagePath) {
@@ -201,6 +315,7 @@ bool LevelManager::CheckBreakableCollision(Vector3 pos, float radius, float dama
             int gx = (int)(b.position.x / mTileSize);
             int gy = (int)(b.position.z / mTileSize);
             if (gx >= 0 && gx < mMapWidth) mCollisionGrid[gy * mMapWidth + gx] = 0;
+            mCollisionVersion++; // Jalan baru kebuka -> flow field rebuild
             
             return true;
         }
@@ -258,50 +373,12 @@ void LevelManager::Draw() {
 }
 
 Vector3 LevelManager::GetPlayerSpawnPoint() {
-    if (!mHasCollisionMap) return {0, 0, 0};
-
-    // Scan for Blue Pixel (Player Spawn)
-    // Blue in Raylib: 0, 121, 241, 255 (Default BLUE)
-    // Our Editor: COL_PLAYER = BLUE
-    for (int y = 0; y < mCollisionMap.height; y++) {
-        for (int x = 0; x < mCollisionMap.width; x++) {
-            Color c = mCollisionPixels[y * mCollisionMap.width + x];
-            
-            // Check for Blue-ish pixel
-            if (c.b > 200 && c.r < 100 && c.g < 150) {
-                 float u = (float)x / mCollisionMap.width;
-                 float v = (float)y / mCollisionMap.height;
-                 
-                 // Map UV to World Coordinates (Plane 100x100)
-                 float worldX = (u - 0.5f) * 100.0f;
-                 float worldZ = (v - 0.5f) * 100.0f;
-                 
-                 return { worldX, 0.0f, worldZ };
-            }
-        }
-    }
-    return {0, 0, 0};
+    // Pixel biru pertama (udah dicari pas compile)
+    return mPlayerSpawn;
 }
 
 std::vector<Vector3> LevelManager::GetEnemySpawnPoints() {
-    std::vector<Vector3> spawns;
-    if (!mHasCollisionMap) return spawns;
-
-    for (int y = 0; y < mCollisionMap.height; y++) {
-        for (int x = 0; x < mCollisionMap.width; x++) {
-            Color c = mCollisionPixels[y * mCollisionMap.width + x];
-            
-            // Check for Red-ish pixel (Enemy Spawn)
-            if (c.r > 200 && c.g < 100 && c.b < 100) {
-                 float u = (float)x / mCollisionMap.width;
-                 float v = (float)y / mCollisionMap.height;
-                 
-                 float worldX = (u - 0.5f) * 100.0f;
-                 float worldZ = (v - 0.5f) * 100.0f;
-                 
-                 spawns.push_back({ worldX, 0.0f, worldZ });
-            }
-        }
-    }
-    return spawns;
-}
\ No newline at end of file
+    // Pixel merah (udah dicari pas compile)
+    if (mEnemySpawns == nullptr) return std::vector<Vector3>();
+    return std::vector<Vector3>(mEnemySpawns, mEnemySpawns + mEnemySpawnCount);
+}
@@ -2,6 +2,9 @@
 #include "raylib.h"
 #include <vector>
 #include <string>
+#include "../Systems/BitGrid.h"
+#include "../Systems/DistanceField.h"
+#include "../Systems/LevelFile.h"
 
 // Definisi Warna Map
 #define COLOR_WALL      WHITE        // 255, 255, 255 (Tembok)
@@ -10,6 +13,8 @@
 #define COLOR_PORTAL    GREEN        // 0, 255, 0     (Pindah Map)
 // Abu-abu (128,128,128) dipakai untuk lantai (Ground Shader)
 
+#define COLLISION_WORLD_SIZE 100.0f  // Collision map nutup plane 100x100 (-50..50)
+
 struct DestructibleWall {
     Vector3 position;
     bool active;
@@ -38,12 +43,28 @@ public:
     bool CheckBreakableCollision(Vector3 pos, float radius, float damage);
 
     // 🔥 FUNGSI BARU UNTUK COLLISION MAP
+    // Cari "<nama>.mblv" dulu (hasil Tools/LevelCompiler, di-mmap tanpa parsing),
+    // kalau gak ada / basi (PNG lebih baru) baru decode PNG + compile di tempat (lambat, cuma fallback)
     void LoadCollisionMap(const char* imagePath);
-    bool IsPixelCollision(Vector3 pos, float radius);
+    bool IsPixelCollision(Vector3 pos, float radius); // Titik tengah doang (radius gak dipakai, sama kayak dulu)
+    bool IsCircleBlocked(Vector3 pos, float radius) const; // 📐 1 sample SDF (radius beneran dipakai)
+    // 📐 Query SDF, O(1) semua -> aman dipanggil per musuh / per peluru
+    float GetWallDistance(Vector3 pos) const;                  // + = kosong, - = di dalam tembok
+    Vector3 GetWallNormal(Vector3 pos) const;                  // Arah menjauh dari tembok terdekat
+    Vector3 ResolveCircle(Vector3 pos, float radius) const;    // Dorong lingkaran keluar tembok
+    bool IsWater(Vector3 pos) const;
+    bool IsBreakablePixel(Vector3 pos) const;
+
+    // 🧭 Buat flow field: collision map diperkecil ke grid cells x cells (1 = tembok/void).
+    // Cell ditandai tembok kalau ADA 1 pixel gelap di dalamnya. false = gak ada collision map.
+    bool BuildBlockedGrid(int cells, std::vector<unsigned char>& outBlocked) const;
+    int GetCollisionVersion() const { return mCollisionVersion; } // Naik tiap map diload / tembok hancur
 
-    // 🔥 Spawn Parsing for Story Mode
+    // 🔥 Spawn Parsing for Story Mode (udah di-scan pas compile, di sini cuma baca tabel)
     Vector3 GetPlayerSpawnPoint();
     std::vector<Vector3> GetEnemySpawnPoints();
+    int GetEnemySpawnCount() const { return mEnemySpawnCount; }
+    Vector3 GetEnemySpawnPoint(int index) const { return mEnemySpawns[index]; } // Tanpa copy (dipakai tiap spawn wave)
 
 private:
     int mMapWidth;
@@ -63,11 +84,27 @@ private:
     Shader mRefShader;  // 🔥 Simpan referensi shader
     bool mShaderSet;
 
-    // 🔥 DATA PIXEL UNTUK COLLISION MAP
-    Image mCollisionMap;
-    Color* mCollisionPixels;
+    // 🔥 DATA COLLISION MAP (sumbernya file .mblv yang di-mmap, atau mCompiled kalau fallback PNG)
     bool mHasCollisionMap;
+    LevelFileView mLevelFile;
+    LevelData mCompiled;
+
+    // 🧱 View ke layer bit & SDF (query tiap tick baca ini, bukan Color 4 byte)
+    BitGrid mSolidBits;     // Pixel gelap (R,G,B < 80) = tembok / void
+    BitGrid mWaterBits;     // COLOR_WATER
+    BitGrid mBreakableBits; // COLOR_BREAKABLE
+    DistanceField mWallField; // 📐 Jarak ke tembok
+    Vector3 mPlayerSpawn;
+    const Vector3* mEnemySpawns;
+    int mEnemySpawnCount;
+
+    bool LoadLevelFile(const char* levelPath, const char* imagePath);
+    bool LoadCollisionImage(const char* imagePath);
+    void UnloadCollisionMap();
+    bool WorldToPixel(Vector3 pos, int& outX, int& outY) const; // false = di luar map
     
     Texture2D mMapTexture; // ✅ Visual Map
     bool mHasMapTexture;
+
+    int mCollisionVersion;
 };
\ No newline at end of file
@@ -1,81 +1,228 @@
 #include "ParticleSystem.h"
+#include "rlgl.h"
 #include <cmath>
-#include <cstdlib>
-#include <algorithm> // Buat std::remove_if
 
-ParticleSystem::ParticleSystem() {
-    mParticles.reserve(1000); // Optimasi memori
+static const float PARTICLE_GRAVITY = 35.0f;
+static const float PARTICLE_BOUNCE = -0.6f;
+
+// Tabel efek (urutan = enum ParticleEffect)
+struct ParticleEffectInfo {
+    const char* name;
+    ParticlePriority priority;
+};
+static const ParticleEffectInfo PARTICLE_EFFECTS[(int)ParticleEffect::COUNT] = {
+    { "boss_spawn",    ParticlePriority::CRITICAL },
+    { "player_death",  ParticlePriority::CRITICAL },
+    { "wave_clear",    ParticlePriority::CRITICAL },
+    { "pickup",        ParticlePriority::GAMEPLAY },
+    { "player_hit",    ParticlePriority::GAMEPLAY },
+    { "exploder",      ParticlePriority::GAMEPLAY },
+    { "bazooka",       ParticlePriority::COSMETIC },
+    { "enemy_death",   ParticlePriority::COSMETIC },
+    { "enemy_hit",     ParticlePriority::COSMETIC },
+    { "bullet_impact", ParticlePriority::COSMETIC },
+    { "wall_chip",     ParticlePriority::COSMETIC },
+};
+
+// 1 selama value <= start, turun linear ke 0 di end
+static float BudgetRamp(float value, float start, float end) {
+    float t = (end - value) / (end - start);
+    return (t < 0.0f) ? 0.0f : ((t > 1.0f) ? 1.0f : t);
+}
+
+ParticleSystem::ParticleSystem(int capacity)
+    : mCapacity(capacity > 0 ? capacity : 1), mCount(0), mDropped(0),
+      mTickBudget(0), mEmittedThisTick(0), mFrameLoad(0.0f), mRngState(0x9E3779B9u) {
+    mTickBudget = mCapacity / 8; // Default: 1/8 pool per tick
+    // Semua column dialokasi sekali di sini, abis itu gak pernah resize lagi
+    mPosX.resize(mCapacity); mPosY.resize(mCapacity); mPosZ.resize(mCapacity);
+    mVelX.resize(mCapacity); mVelY.resize(mCapacity); mVelZ.resize(mCapacity);
+    mSize.resize(mCapacity);
+    mLife.resize(mCapacity);
+    mInvMaxLife.resize(mCapacity);
+    mColor.resize(mCapacity);
+
+    // Tabel arah: theta U[0,360], phi U[0,180] (sama kayak logic lama, cuma trig-nya dihitung sekali)
+    mDirections.resize(DIRECTION_TABLE_SIZE);
+    for (int i = 0; i < DIRECTION_TABLE_SIZE; i++) {
+        float theta = RandomRange(0.0f, 360.0f) * DEG2RAD;
+        float phi = RandomRange(0.0f, 180.0f) * DEG2RAD;
+        mDirections[i] = { sinf(phi) * cosf(theta), cosf(phi), sinf(phi) * sinf(theta) };
+    }
 }
 
 void ParticleSystem::Update(float dt) {
-    float gravity = 35.0f; 
-
-    for (auto& p : mParticles) {
-        if (!p.active) continue;
-        
-        // Fisika
-        p.velocity.y -= gravity * dt;
-        p.position = Vector3Add(p.position, Vector3Scale(p.velocity, dt));
-        
-        // Bounce di lantai
-        if (p.position.y < 0) { 
-            p.position.y = 0; 
-            p.velocity.y *= -0.6f; 
-        }
-        
-        // Umur
-        p.life -= dt;
-        if (p.life <= 0) {
-            p.active = false;
-        } else {
-             // Fade out alpha
-             float alpha = p.life / p.maxLife;
-             p.color.a = (unsigned char)(alpha * 255);
-        }
+    mEmittedThisTick = 0;
+
+    const int n = mCount;
+    float* px = mPosX.data(); float* py = mPosY.data(); float* pz = mPosZ.data();
+    float* vx = mVelX.data(); float* vy = mVelY.data(); float* vz = mVelZ.data();
+    float* life = mLife.data();
+
+    // 1. Gravitasi + gerak (float rapat, tanpa branch)
+    const float gravityStep = PARTICLE_GRAVITY * dt;
+    for (int i = 0; i < n; i++) {
+        vy[i] -= gravityStep;
+        px[i] += vx[i] * dt;
+        py[i] += vy[i] * dt;
+        pz[i] += vz[i] * dt;
     }
 
-    // Cleanup partikel mati (Lambda)
-    mParticles.erase(std::remove_if(mParticles.begin(), mParticles.end(), 
-        [](const Particle& p){ return !p.active; }), 
-        mParticles.end());
+    // 2. Bounce di lantai (select, bukan if -> tetap vectorizable)
+    for (int i = 0; i < n; i++) {
+        bool below = py[i] < 0.0f;
+        vy[i] = below ? vy[i] * PARTICLE_BOUNCE : vy[i];
+        py[i] = below ? 0.0f : py[i];
+    }
+
+    // 3. Umur
+    for (int i = 0; i < n; i++) life[i] -= dt;
+
+    // 4. Buang yang mati (swap-remove). Jalan mundur biar partikel yang dipindah udah dicek
+    for (int i = mCount - 1; i >= 0; i--) {
+        if (life[i] <= 0.0f) Kill(i);
+    }
+}
+
+void ParticleSystem::Kill(int i) {
+    int last = mCount - 1;
+    if (i != last) {
+        mPosX[i] = mPosX[last]; mPosY[i] = mPosY[last]; mPosZ[i] = mPosZ[last];
+        mVelX[i] = mVelX[last]; mVelY[i] = mVelY[last]; mVelZ[i] = mVelZ[last];
+        mSize[i] = mSize[last];
+        mLife[i] = mLife[last];
+        mInvMaxLife[i] = mInvMaxLife[last];
+        mColor[i] = mColor[last];
+    }
+    mCount--;
 }
 
 void ParticleSystem::Draw() {
-    // Loop gambar simpel
-    for(const auto& p : mParticles) {
-        if(!p.active) continue;
-        DrawCube(p.position, p.size, p.size, p.size, p.color);
+    for (int i = 0; i < mCount; i++) {
+        // Fade out alpha dari sisa umur
+        Color c = mColor[i];
+        c.a = (unsigned char)(mLife[i] * mInvMaxLife[i] * 255.0f);
+        float s = mSize[i];
+        DrawCube({ mPosX[i], mPosY[i], mPosZ[i] }, s, s, s, c);
+    }
+}
+
+int ParticleSystem::DrawInstanced(InstanceBatch& batch, const Mesh& mesh, const Material& material) {
+    if (mCount == 0) return 0;
+
+    for (int i = 0; i < mCount; i++) {
+        Color c = mColor[i];
+        float alpha = mLife[i] * mInvMaxLife[i];
+        batch.AddData((Vector4){ mPosX[i], mPosY[i], mPosZ[i], mSize[i] },
+                      (Vector4){ c.r / 255.0f, c.g / 255.0f, c.b / 255.0f, alpha });
+    }
+
+    // Transparan: depth test tetap jalan (ketutup tembok/musuh), tapi gak nulis depth
+    // biar partikel yang lagi fade gak "motong" partikel di belakangnya
+    BeginBlendMode(BLEND_ALPHA);
+    rlDisableDepthMask();
+    int drawCalls = batch.Flush(mesh, material);
+    rlEnableDepthMask();
+    EndBlendMode();
+    return drawCalls;
+}
+
+int ParticleSystem::Emit(const ParticleBurst& burst) {
+    int room = mCapacity - mCount;
+    int count = burst.count < room ? burst.count : room;
+    if (count < 0) count = 0;
+    if (burst.count > count) mDropped += burst.count - count;
+
+    Color base = burst.color;
+    base.a = 255;
+
+    int start = mCount;
+    for (int k = 0; k < count; k++) {
+        int i = start + k;
+        const Vector3& dir = mDirections[NextRandom() & (DIRECTION_TABLE_SIZE - 1)];
+        float speed = RandomRange(burst.speedMin, burst.speedMax);
+        float life = RandomRange(burst.lifeMin, burst.lifeMax);
+
+        mPosX[i] = burst.center.x; mPosY[i] = burst.center.y; mPosZ[i] = burst.center.z;
+        mVelX[i] = dir.x * speed; mVelY[i] = dir.y * speed; mVelZ[i] = dir.z * speed;
+        mSize[i] = RandomRange(burst.sizeMin, burst.sizeMax);
+        mLife[i] = life;
+        mInvMaxLife[i] = 1.0f / life;
+        mColor[i] = base;
     }
+    mCount += count;
+    return count;
 }
 
-void ParticleSystem::SpawnExplosion(Vector3 center, Color color, int count) {
-    for(int i=0; i<count; i++) {
-        Particle p;
-        p.position = center;
-        
-        // Logic acak-acak arah (sama kayak yang lama)
-        float theta = GetRandomFloat(0, 360) * DEG2RAD;
-        float phi = GetRandomFloat(0, 180) * DEG2RAD;
-        float speed = GetRandomFloat(5.0f, 15.0f);
-        
-        p.velocity.x = sinf(phi) * cosf(theta) * speed;
-        p.velocity.y = cosf(phi) * speed;
-        p.velocity.z = sinf(phi) * sinf(theta) * speed;
-        
-        p.size = GetRandomFloat(0.2f, 0.6f);
-        p.color = color;
-        p.life = GetRandomFloat(0.4f, 0.8f);
-        p.maxLife = p.life;
-        p.active = true;
-        
-        mParticles.push_back(p);
+int ParticleSystem::SpawnExplosion(ParticleEffect effect, Vector3 center, Color color, int count) {
+    ParticleEffectStats& stats = mEffectStats[(int)effect];
+    stats.requested += count;
+
+    float scale = GetScale(GetEffectPriority(effect));
+    int scaled = (int)(count * scale + 0.5f);
+    if (scaled <= 0) return 0;
+
+    ParticleBurst burst;
+    burst.center = center;
+    burst.color = color;
+    burst.count = scaled;
+    int emitted = Emit(burst);
+
+    stats.emitted += emitted;
+    mEmittedThisTick += emitted;
+    return emitted;
+}
+
+float ParticleSystem::GetScale(ParticlePriority priority) const {
+    if (priority == ParticlePriority::CRITICAL) return 1.0f;
+
+    float poolFill = (float)mCount / (float)mCapacity;
+    float tickFill = (mTickBudget > 0) ? (float)mEmittedThisTick / (float)mTickBudget : 0.0f;
+
+    float poolScale, tickScale, frameScale;
+    if (priority == ParticlePriority::GAMEPLAY) {
+        poolScale = BudgetRamp(poolFill, 0.75f, 0.95f);
+        tickScale = BudgetRamp(tickFill, 1.0f, 2.0f);
+        frameScale = 1.0f - 0.5f * mFrameLoad;
+    } else {
+        poolScale = BudgetRamp(poolFill, 0.5f, 0.85f);
+        tickScale = BudgetRamp(tickFill, 0.5f, 1.0f);
+        frameScale = 1.0f - mFrameLoad;
     }
+    return fminf(poolScale, fminf(tickScale, frameScale));
+}
+
+void ParticleSystem::SetFrameTime(float frameTime) {
+    // 60 FPS (16.7 ms) = aman, 30 FPS (33.3 ms) = load penuh. Dihaluskan biar 1 spike gak bikin kedip
+    float load = 1.0f - BudgetRamp(frameTime, 1.0f / 60.0f, 1.0f / 30.0f);
+    mFrameLoad += (load - mFrameLoad) * 0.1f;
+}
+
+const char* ParticleSystem::GetEffectName(ParticleEffect effect) {
+    return PARTICLE_EFFECTS[(int)effect].name;
+}
+
+ParticlePriority ParticleSystem::GetEffectPriority(ParticleEffect effect) {
+    return PARTICLE_EFFECTS[(int)effect].priority;
 }
 
 void ParticleSystem::Reset() {
-    mParticles.clear();
+    mCount = 0;
+    mDropped = 0;
+    mEmittedThisTick = 0;
+    for (auto& stats : mEffectStats) stats = ParticleEffectStats();
 }
 
-float ParticleSystem::GetRandomFloat(float min, float max) {
-    return min + ((float)GetRandomValue(0, 10000) / 10000.0f) * (max - min);
-}
\ No newline at end of file
+unsigned int ParticleSystem::NextRandom() {
+    // xorshift32
+    unsigned int x = mRngState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    mRngState = x;
+    return x;
+}
+
+float ParticleSystem::RandomRange(float min, float max) {
+    return min + (float)(NextRandom() >> 8) * (1.0f / 16777216.0f) * (max - min);
+}
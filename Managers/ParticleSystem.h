@@ -1,32 +1,113 @@
 #pragma once
 #include "raylib.h"
 #include "raymath.h"
+#include "../Systems/InstanceBatch.h"
 #include <vector>
 
-// Struct Particle kita pindah kesini
-struct Particle {
-    Vector3 position;
-    Vector3 velocity;
+// 💥 Satu ledakan partikel (bulk emit). Default = nilai SpawnExplosion lama
+struct ParticleBurst {
+    Vector3 center;
     Color color;
-    float size;
-    float life;
-    float maxLife;
-    bool active;
+    int count;
+    float speedMin = 5.0f;
+    float speedMax = 15.0f;
+    float sizeMin = 0.2f;
+    float sizeMax = 0.6f;
+    float lifeMin = 0.4f;
+    float lifeMax = 0.8f;
 };
 
+// 🏷️ Jenis efek (buat budget + counter per efek). Urutan = index tabel PARTICLE_EFFECTS di .cpp
+enum class ParticleEffect {
+    BOSS_SPAWN,
+    PLAYER_DEATH,
+    WAVE_CLEAR,
+    PICKUP,         // Magnet / health / weapon
+    PLAYER_HIT,     // Kena peluru musuh
+    EXPLODER,       // Ledakan exploder (telegraph damage)
+    BAZOOKA,        // Ledakan roket player
+    ENEMY_DEATH,
+    ENEMY_HIT,
+    BULLET_IMPACT,  // Telor pecah (peluru player habis umur)
+    WALL_CHIP,      // Peluru musuh kena tembok breakable
+
+    COUNT
+};
+
+// Makin ke bawah makin gampang dikorbanin pas pool / frame time mepet
+enum class ParticlePriority {
+    CRITICAL,   // Momen penting: gak pernah di-scale (cuma kepotong kalau pool bener-bener penuh)
+    GAMEPLAY,   // Feedback ke player: baru dikurangin pas pool hampir penuh
+    COSMETIC    // Hiasan horde: paling duluan dikurangin
+};
+
+struct ParticleEffectStats {
+    long requested = 0; // Total yang diminta pemanggil
+    long emitted = 0;   // Yang beneran masuk pool
+    long Dropped() const { return requested - emitted; }
+};
+
+// ✨ PARTICLE SYSTEM (Struct of Arrays, kapasitas tetap)
+// Tiap field partikel punya array float sendiri, jadi loop gravitasi / bounce / umur
+// cuma jalan di atas float rapat (bisa di-vectorize compiler, gak ada branch per field).
+// Slot [0, Count()) = hidup semua. Mati = slot diisi partikel terakhir (swap-remove),
+// gak ada erase / remove_if / push_back di tengah game. Pool penuh = sisa burst dibuang.
+//
+// 📊 BUDGET: SpawnExplosion(effect, ...) nge-scale jumlah partikel sesuai prioritas efek,
+// isi pool, partikel yang udah di-emit tick ini, & frame time (SetFrameTime). Jadi chain
+// exploder / shotgun ke horde gak bisa nambah ribuan partikel sekaligus.
 class ParticleSystem {
 public:
-    ParticleSystem();
-    
+    explicit ParticleSystem(int capacity = 8192);
+
     // Fungsi Utama
     void Update(float dt);
-    void Draw();
-    void SpawnExplosion(Vector3 center, Color color, int count);
+    void Draw(); // Fallback: DrawCube per partikel (shader instanced gagal / GPU tua)
+    // 1 DrawMeshInstanced buat semua partikel (material pakai VS_PARTICLE_CODE). Return jumlah draw call
+    int DrawInstanced(InstanceBatch& batch, const Mesh& mesh, const Material& material);
+    // Lewat budget (dipakai semua efek game). Return jumlah yang beneran di-emit
+    int SpawnExplosion(ParticleEffect effect, Vector3 center, Color color, int count);
+    int Emit(const ParticleBurst& burst); // Mentah tanpa budget (cuma dibatasi kapasitas)
     void Reset(); // Buat bersihin partikel pas Game Over/Reset
 
+    int Count() const { return mCount; }
+    int Capacity() const { return mCapacity; }
+    int Dropped() const { return mDropped; } // Total partikel yang ditolak karena pool penuh
+
+    // --- BUDGET ---
+    void SetFrameTime(float frameTime); // Dipanggil tiap frame render (headless: gak pernah -> 0)
+    void SetTickBudget(int particlesPerTick) { mTickBudget = particlesPerTick; }
+    float GetScale(ParticlePriority priority) const; // 0..1 faktor jumlah saat ini
+    const ParticleEffectStats& GetEffectStats(ParticleEffect effect) const { return mEffectStats[(int)effect]; }
+    static const char* GetEffectName(ParticleEffect effect);
+    static ParticlePriority GetEffectPriority(ParticleEffect effect);
+
 private:
-    std::vector<Particle> mParticles;
-    
-    // Helper khusus buat partikel
-    float GetRandomFloat(float min, float max);
-};
\ No newline at end of file
+    int mCapacity;
+    int mCount;
+    int mDropped;
+
+    // --- COLUMNS ---
+    std::vector<float> mPosX, mPosY, mPosZ;
+    std::vector<float> mVelX, mVelY, mVelZ;
+    std::vector<float> mSize;
+    std::vector<float> mLife;
+    std::vector<float> mInvMaxLife; // 1 / umur awal (fade = life * ini, tanpa bagi)
+    std::vector<Color> mColor;      // RGB dasar, alpha dihitung dari umur pas Draw
+
+    void Kill(int i); // Swap-remove
+
+    int mTickBudget;      // Partikel per tick sebelum COSMETIC/GAMEPLAY mulai di-scale
+    int mEmittedThisTick; // Reset tiap Update
+    float mFrameLoad;     // 0 = 60 FPS aman, 1 = udah <= 30 FPS (dihaluskan)
+    ParticleEffectStats mEffectStats[(int)ParticleEffect::COUNT];
+
+    // Arah acak di bola (distribusi sama kayak theta/phi lama), dihitung sekali di constructor
+    static const int DIRECTION_TABLE_SIZE = 1024;
+    std::vector<Vector3> mDirections;
+
+    // RNG sendiri (xorshift) biar efek kosmetik gak ngegeser urutan GetRandomValue gameplay
+    unsigned int mRngState;
+    unsigned int NextRandom();
+    float RandomRange(float min, float max);
+};
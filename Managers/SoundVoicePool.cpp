@@ -0,0 +1,121 @@
+#include "SoundVoicePool.h"
+#include "AssetManager.h"
+
+// Tabel efek (urutan = enum SoundEffect).
+// Volume diset ulang di alias (alias mulai dari volume 1, gak ikut SetSoundVolume sumbernya)
+struct SoundEffectInfo {
+    const char* name;
+    const char* sound;  // Nama Sound sumber di AssetManager
+    int maxVoices;
+    float volume;
+    float pitchMin;
+    float pitchMax;
+};
+static const SoundEffectInfo SOUND_EFFECTS[(int)SoundEffect::COUNT] = {
+    { "bullet_hit",    "crack", 4, 0.02f, 1.8f, 2.2f },
+    { "bullet_impact", "crack", 3, 0.02f, 1.8f, 2.2f },
+    { "wall_hit",      "crack", 2, 0.02f, 0.7f, 0.9f }, // Suara lebih berat buat tembok
+};
+
+SoundVoicePool::SoundVoicePool() : mRngState(0x85EBCA6Bu) {}
+
+SoundVoicePool::~SoundVoicePool() {
+    Unload();
+}
+
+void SoundVoicePool::Load(AssetManager& assets) {
+    Unload();
+    for (int i = 0; i < (int)SoundEffect::COUNT; i++) {
+        const SoundEffectInfo& info = SOUND_EFFECTS[i];
+        SoundHandle source = assets.FindSound(info.sound);
+        if (!assets.IsSoundReady(source)) continue;
+
+        EffectVoices& effect = mEffects[i];
+        for (int v = 0; v < info.maxVoices; v++) {
+            Sound alias = LoadSoundAlias(assets.GetSound(source));
+            SetSoundVolume(alias, info.volume);
+            effect.voices.push_back(alias);
+        }
+    }
+}
+
+void SoundVoicePool::Unload() {
+    for (auto& effect : mEffects) {
+        for (Sound& alias : effect.voices) UnloadSoundAlias(alias);
+        effect.voices.clear();
+        effect.next = 0;
+    }
+}
+
+void SoundVoicePool::BeginTick() {
+    for (auto& effect : mEffects) effect.triggeredThisTick = false;
+}
+
+bool SoundVoicePool::Play(SoundEffect effectId) {
+    const SoundEffectInfo& info = SOUND_EFFECTS[(int)effectId];
+    EffectVoices& effect = mEffects[(int)effectId];
+    SoundEffectStats& stats = mStats[(int)effectId];
+    stats.triggers++;
+
+    // Shotgun 8 peluru kena di tick yang sama = 1 bunyi aja
+    if (effect.triggeredThisTick) {
+        stats.coalesced++;
+        return false;
+    }
+    effect.triggeredThisTick = true;
+
+    int count = (int)effect.voices.size();
+    if (count == 0) return false; // Headless / sound gak ada: cuma dihitung
+
+    // Cari voice nganggur (round robin). Semua sibuk = buang, jangan potong yang lagi bunyi
+    for (int n = 0; n < count; n++) {
+        int v = (effect.next + n) % count;
+        Sound& voice = effect.voices[v];
+        if (IsSoundPlaying(voice)) continue;
+
+        // Pitch cuma ngubah alias ini, Sound sumber tetap
+        SetSoundPitch(voice, RandomRange(info.pitchMin, info.pitchMax));
+        PlaySound(voice);
+        effect.next = (v + 1) % count;
+        stats.played++;
+
+        int inUse = VoicesInUse(effectId);
+        if (inUse > stats.peakVoices) stats.peakVoices = inUse;
+        return true;
+    }
+
+    stats.dropped++;
+    return false;
+}
+
+int SoundVoicePool::VoicesInUse(SoundEffect effectId) const {
+    int inUse = 0;
+    for (const Sound& voice : mEffects[(int)effectId].voices) {
+        if (IsSoundPlaying(voice)) inUse++;
+    }
+    return inUse;
+}
+
+int SoundVoicePool::TotalVoicesInUse() const {
+    int total = 0;
+    for (int i = 0; i < (int)SoundEffect::COUNT; i++) total += VoicesInUse((SoundEffect)i);
+    return total;
+}
+
+const char* SoundVoicePool::GetEffectName(SoundEffect effect) {
+    return SOUND_EFFECTS[(int)effect].name;
+}
+
+unsigned int SoundVoicePool::NextRandom() {
+    // xorshift32 (sama kayak ParticleSystem)
+    unsigned int x = mRngState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    mRngState = x;
+    return x;
+}
+
+float SoundVoicePool::RandomRange(float min, float max) {
+    return min + (float)(NextRandom() >> 8) * (1.0f / 16777216.0f) * (max - min);
+}
@@ -0,0 +1,61 @@
+#pragma once
+#include "raylib.h"
+#include <vector>
+
+class AssetManager;
+
+// 🏷️ SFX yang sering di-trigger (peluru). Urutan = index tabel SOUND_EFFECTS di .cpp
+enum class SoundEffect {
+    BULLET_HIT,     // Peluru player kena musuh
+    BULLET_IMPACT,  // Telor pecah di tanah
+    WALL_HIT,       // Peluru kena tembok breakable
+
+    COUNT
+};
+
+struct SoundEffectStats {
+    long triggers = 0;  // Total Play() dari gameplay
+    long played = 0;    // Yang beneran dapet voice
+    long coalesced = 0; // Digabung karena efek yang sama udah bunyi di tick ini
+    long dropped = 0;   // Semua voice efek ini lagi sibuk
+    int peakVoices = 0;
+};
+
+// 🔊 VOICE POOL: tiap efek punya beberapa alias (LoadSoundAlias) dari 1 Sound sumber di AssetManager.
+// Alias = data sample sama, tapi pitch / volume / posisi play sendiri. Jadi minigun gak lagi
+// restart 1 Sound yang sama puluhan kali per detik (bunyinya kepotong), dan pitch acak per hit
+// gak ngubah Sound aslinya.
+// Batas voice per efek: semua sibuk = trigger dibuang. Trigger kedua dst di 1 tick = digabung.
+class SoundVoicePool {
+public:
+    SoundVoicePool();
+    ~SoundVoicePool();
+
+    void Load(AssetManager& assets); // Butuh audio device + sound sumber udah diload
+    void Unload();                   // Wajib sebelum AssetManager::UnloadAll (alias numpang data sumber)
+
+    void BeginTick(); // Awal tiap tick simulasi (reset penggabung trigger)
+    bool Play(SoundEffect effect); // true = voice baru mulai bunyi
+
+    // --- COUNTER ---
+    int VoicesInUse(SoundEffect effect) const;
+    int TotalVoicesInUse() const;
+    const SoundEffectStats& GetStats(SoundEffect effect) const { return mStats[(int)effect]; }
+    static const char* GetEffectName(SoundEffect effect);
+
+private:
+    struct EffectVoices {
+        std::vector<Sound> voices; // Alias, kosong = efek gak ada (headless / aset hilang)
+        int next = 0;              // Round robin mulai dari sini
+        bool triggeredThisTick = false;
+    };
+
+    EffectVoices mEffects[(int)SoundEffect::COUNT];
+    SoundEffectStats mStats[(int)SoundEffect::COUNT];
+
+    // RNG pitch sendiri (xorshift): voice nganggur atau gak tergantung mixer, jangan sampai
+    // ngegeser urutan GetRandomValue gameplay (seed headless vs window jadi beda)
+    unsigned int mRngState;
+    unsigned int NextRandom();
+    float RandomRange(float min, float max);
+};
@@ -3,6 +3,7 @@
 #include <cmath>
 #include <algorithm>
 #include "../Systems/ProjectileManager.h"
+#include "../Systems/ShadowBatch.h"
 #include "../Utils/MathUtils.h" 
 
 // Helper buat rotasi sudut
@@ -12,12 +13,13 @@ float LerpAngle(float current, float target, float t) {
     return current + diff * fminf(t, 1.0f);
 }
 
-Player::Player() {
+Player::Player() : godMode(false) {
     Reset();
 }
 
 void Player::Reset() {
     position = { 0, 0.5f, 0 };
+    prevPosition = position;
     rotationY = 0.0f;
     walkTimer = 0.0f;
     shootTimer = 0.0f;
@@ -86,28 +88,30 @@ void Player::SwitchWeapon(WeaponType type) {
     }
 }
 
-void Player::Update(float dt) {
-    if (IsDead()) return;
-
-    if (shootTimer > 0) shootTimer -= dt;
-    if (magnetBuffTimer > 0) magnetBuffTimer -= dt;
-    if (dashCooldown > 0) dashCooldown -= dt;
-
-    if (IsKeyPressed(KEY_ONE)) SwitchWeapon(WeaponType::PISTOL);
-    if (IsKeyPressed(KEY_TWO)) SwitchWeapon(WeaponType::SHOTGUN);
-    if (IsKeyPressed(KEY_THREE)) SwitchWeapon(WeaponType::MINIGUN);
-    if (IsKeyPressed(KEY_FOUR)) SwitchWeapon(WeaponType::BAZOOKA);
+void Player::ApplyWeaponInput(const PlayerInput& controls) {
+    if (controls.weaponSelect >= 0 && controls.weaponSelect <= 3) {
+        SwitchWeapon((WeaponType)controls.weaponSelect);
+    }
 
-    float scroll = GetMouseWheelMove();
-    if (scroll != 0) {
+    if (controls.weaponScroll != 0) {
         int current = (int)currentWeapon;
-        current += (scroll > 0) ? 1 : -1;
+        current += (controls.weaponScroll > 0) ? 1 : -1;
         
         if (current > 3) current = 0;
         if (current < 0) current = 3;
         
         SwitchWeapon((WeaponType)current);
     }
+}
+
+void Player::Update(float dt, const PlayerInput& controls) {
+    if (IsDead()) return;
+
+    if (shootTimer > 0) shootTimer -= dt;
+    if (magnetBuffTimer > 0) magnetBuffTimer -= dt;
+    if (dashCooldown > 0) dashCooldown -= dt;
+
+    ApplyWeaponInput(controls);
 
     // DASH OVERRIDE MOVEMENT DENGAN PHASING (Anticipate, Action, Recovery)
     if (dashTime > 0.0f) {
@@ -127,11 +131,7 @@ void Player::Update(float dt) {
     }
 
     // Normal Movement Logic
-    Vector3 input = { 0, 0, 0 };
-    if (IsKeyDown(KEY_W)) input.z -= 1;
-    if (IsKeyDown(KEY_S)) input.z += 1;
-    if (IsKeyDown(KEY_A)) input.x -= 1;
-    if (IsKeyDown(KEY_D)) input.x += 1;
+    Vector3 input = controls.moveDir;
 
     if (Vector3Length(input) > 0) {
         input = Vector3Normalize(input);
@@ -199,13 +199,14 @@ void Player::LevelUp() {
     hp = maxHp; 
 }
 
-void Player::Draw(Model& ayamModel, Camera3D cam, Texture2D shadow) {
+void Player::Draw(Model& ayamModel, Camera3D cam, ShadowBatch& shadows, float alpha) {
     if (IsDead()) return;
 
     float hop = fabsf(sinf(walkTimer)) * 0.15f; 
     float tilt = sinf(walkTimer) * 12.0f; 
 
-    Vector3 drawPos = position;
+    Vector3 renderPos = GetRenderPosition(alpha);
+    Vector3 drawPos = renderPos;
     
     // --- VARIABEL ANIMASI DASH (Squash & Stretch) ---
     float dashScaleY = 1.0f;
@@ -244,18 +245,9 @@ void Player::Draw(Model& ayamModel, Camera3D cam, Texture2D shadow) {
         }
     }
 
-    // --- DRAW SHADOW ---
+    // --- SHADOW (ikut squash dash) ---
     float shadowSize = 1.2f * dashScaleXZ; 
-    rlPushMatrix();
-        rlTranslatef(position.x, 0.01f, position.z); 
-        rlRotatef(90, 1, 0, 0);
-        rlDisableDepthMask();
-        DrawTexturePro(shadow, 
-            (Rectangle){ 0, 0, (float)shadow.width, (float)shadow.height },
-            (Rectangle){ -shadowSize/2, -shadowSize/2, shadowSize, shadowSize },
-            (Vector2){ 0, 0 }, 0.0f, ColorAlpha(WHITE, 0.5f));
-        rlEnableDepthMask();
-    rlPopMatrix();
+    shadows.Add({ renderPos.x, 0.01f, renderPos.z }, shadowSize, ColorAlpha(WHITE, 0.5f));
 
     // --- DRAW MODEL ---
     if (ayamModel.meshCount > 0) {
@@ -289,6 +281,7 @@ void Player::AddXP(float amount) {
 
 void Player::TakeDamage(float amount) {
     if (dashTime > 0.0f) return; // I-Frames (Kebal saat salto)
+    if (godMode) return;
 
     hp -= amount;
     if (hp < 0) hp = 0;
@@ -303,7 +296,7 @@ void Player::ActivateMagnetBuff(float duration) {
     magnetBuffTimer = duration;
 }
 
-Vector3 Player::GetFuturePosition(float dt) {
+Vector3 Player::GetFuturePosition(float dt, const PlayerInput& controls) {
     if (IsDead()) return position;
 
     Vector3 nextPos = position;
@@ -329,11 +322,7 @@ Vector3 Player::GetFuturePosition(float dt) {
     }
 
     // 2. NORMAL MOVEMENT PREDICTION
-    Vector3 input = { 0, 0, 0 };
-    if (IsKeyDown(KEY_W)) input.z -= 1;
-    if (IsKeyDown(KEY_S)) input.z += 1;
-    if (IsKeyDown(KEY_A)) input.x -= 1;
-    if (IsKeyDown(KEY_D)) input.x += 1;
+    Vector3 input = controls.moveDir;
 
     if (Vector3Length(input) > 0) {
         input = Vector3Normalize(input);
@@ -343,7 +332,7 @@ Vector3 Player::GetFuturePosition(float dt) {
     return nextPos;
 }
 
-void Player::UpdateRotationOnly(float dt) {
+void Player::UpdateRotationOnly(float dt, const PlayerInput& controls) {
     if (IsDead()) return;
 
     // --- STATE UPDATES (TIMERS) ---
@@ -353,29 +342,13 @@ void Player::UpdateRotationOnly(float dt) {
     if (dashTime > 0.0f) dashTime -= dt; // Decrement dashTime here
 
     // --- WEAPON SWITCHING ---
-    if (IsKeyPressed(KEY_ONE)) SwitchWeapon(WeaponType::PISTOL);
-    if (IsKeyPressed(KEY_TWO)) SwitchWeapon(WeaponType::SHOTGUN);
-    if (IsKeyPressed(KEY_THREE)) SwitchWeapon(WeaponType::MINIGUN);
-    if (IsKeyPressed(KEY_FOUR)) SwitchWeapon(WeaponType::BAZOOKA);
-
-    float scroll = GetMouseWheelMove();
-    if (scroll != 0) {
-        int current = (int)currentWeapon;
-        current += (scroll > 0) ? 1 : -1;
-        if (current > 3) current = 0;
-        if (current < 0) current = 3;
-        SwitchWeapon((WeaponType)current);
-    }
+    ApplyWeaponInput(controls);
 
     // --- ROTATION & ANIMATION ---
     // Jangan proses rotasi kalau lagi dashing (terkunci)
     if (dashTime > 0.0f) return;
 
-    Vector3 input = { 0, 0, 0 };
-    if (IsKeyDown(KEY_W)) input.z -= 1;
-    if (IsKeyDown(KEY_S)) input.z += 1;
-    if (IsKeyDown(KEY_A)) input.x -= 1;
-    if (IsKeyDown(KEY_D)) input.x += 1;
+    Vector3 input = controls.moveDir;
 
     if (Vector3Length(input) > 0) {
         float targetRotation = (atan2f(input.x, input.z) * RAD2DEG) + 90.0f;
@@ -6,6 +6,7 @@
 #include "../Systems/ProjectileManager.h"
 
 class ProjectileManager;
+class ShadowBatch;
 
 enum class WeaponType {
     PISTOL,     
@@ -14,6 +15,26 @@ enum class WeaponType {
     BAZOOKA     
 };
 
+// 🎮 SNAPSHOT INPUT PLAYER
+// Diisi Game dari keyboard/mouse (mode window) atau dari bot script (mode headless),
+// jadi simulasi Player gak pernah baca raylib input langsung.
+struct PlayerInput {
+    Vector3 moveDir = { 0, 0, 0 };   // WASD mentah (belum dinormalisasi)
+    Vector3 aimTarget = { 0, 0, 0 }; // Titik bidikan di lantai (world space)
+    bool fireHeld = false;           // Klik kiri ditahan
+
+    // Edge event: ditahan sampai tick simulasi berikutnya, lalu di-clear
+    bool dashReleased = false;       // Klik kanan dilepas
+    int weaponSelect = -1;           // -1 = gak ganti, 0-3 = Pistol..Bazooka
+    int weaponScroll = 0;            // >0 senjata berikutnya, <0 sebelumnya
+
+    void ClearEdges() {
+        dashReleased = false;
+        weaponSelect = -1;
+        weaponScroll = 0;
+    }
+};
+
 struct PlayerStats {
     float fireRate;        
     int projectileCount;   
@@ -29,12 +50,14 @@ class Player {
 public:
     Player();
     void Reset();
-    void Update(float dt);
+    void Update(float dt, const PlayerInput& controls);
     // 🔥 Metode baru untuk sistem collision physics
-    Vector3 GetFuturePosition(float dt);
-    void UpdateRotationOnly(float dt);
+    Vector3 GetFuturePosition(float dt, const PlayerInput& controls);
+    void UpdateRotationOnly(float dt, const PlayerInput& controls);
     
-    void Draw(Model& ayamModel, Camera3D cam, Texture2D shadow);
+    // alpha = interpolasi render antara tick sebelumnya & sekarang (1.0 = posisi terbaru)
+    // Shadow cuma dititip ke batch, digambar Game bareng shadow musuh
+    void Draw(Model& ayamModel, Camera3D cam, ShadowBatch& shadows, float alpha = 1.0f);
 
     // Shooting & Dash System
     void TryShoot(Vector3 targetPos, ProjectileManager& projManager, float dt);
@@ -52,6 +75,7 @@ public:
     void TakeDamage(float amount);
     void Heal(float amount);
     bool IsDead() const { return hp <= 0; }
+    void SetGodMode(bool enabled) { godMode = enabled; } // Buat soak test headless
 
     // Magnet Buff
     void ActivateMagnetBuff(float duration);
@@ -61,6 +85,10 @@ public:
     Vector3 GetPosition() const { return position; }
     void SetPosition(Vector3 pos) { position = pos; } 
 
+    // Fixed timestep: simpan posisi tick lama & ambil posisi buat render
+    void SavePreviousState() { prevPosition = position; }
+    Vector3 GetRenderPosition(float alpha) const { return Vector3Lerp(prevPosition, position, alpha); }
+
     void PushBack(Vector3 direction, float distance) {
         position = Vector3Add(position, Vector3Scale(direction, distance));
     }
@@ -74,6 +102,7 @@ public:
 
 private:
     Vector3 position;
+    Vector3 prevPosition;
     float rotationY;
     float walkTimer;
     float shootTimer; 
@@ -96,4 +125,9 @@ private:
 
     // Buffs
     float magnetBuffTimer;
+
+    bool godMode;
+
+    // Helper ganti senjata dari input (angka 1-4 / scroll)
+    void ApplyWeaponInput(const PlayerInput& controls);
 };
\ No newline at end of file
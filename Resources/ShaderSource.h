@@ -13,21 +13,58 @@ inline const char* VS_CODE = R"(
     out vec3 fragPosition;
     out vec2 fragTexCoord;
     out vec3 fragNormal;
+    out vec4 fragColor; // Warna per-instance (non-instanced = putih, warna dari colDiffuse)
 
     void main() {
         fragPosition = vec3(matModel * vec4(vertexPosition, 1.0));
         fragTexCoord = vertexTexCoord; 
         fragNormal = normalize(vec3(matNormal * vec4(vertexNormal, 1.0)));
+        fragColor = vec4(1.0);
         gl_Position = mvp * vec4(vertexPosition, 1.0);
     }
 )";
 
+// 🧊 Vertex Shader INSTANCED (DrawMeshInstanced, lihat Systems/InstanceBatch.h)
+// Baris bawah instanceTransform = warna instance, dibalikin ke (0,0,0,1) sebelum dipakai.
+// Fragment shader-nya sama (FS_GROUND_CODE / FS_SLIME_CODE).
+inline const char* VS_INSTANCED_CODE = R"(
+    #version 330
+    layout(location = 0) in vec3 vertexPosition;
+    layout(location = 1) in vec2 vertexTexCoord;
+    layout(location = 2) in vec3 vertexNormal;
+    in mat4 instanceTransform;
+
+    uniform mat4 mvp;
+
+    out vec3 fragPosition;
+    out vec2 fragTexCoord;
+    out vec3 fragNormal;
+    out vec4 fragColor;
+
+    void main() {
+        fragColor = vec4(instanceTransform[0][3], instanceTransform[1][3],
+                         instanceTransform[2][3], instanceTransform[3][3]);
+
+        mat4 model = instanceTransform;
+        model[0][3] = 0.0;
+        model[1][3] = 0.0;
+        model[2][3] = 0.0;
+        model[3][3] = 1.0;
+
+        fragPosition = vec3(model * vec4(vertexPosition, 1.0));
+        fragTexCoord = vertexTexCoord;
+        fragNormal = normalize(transpose(inverse(mat3(model))) * vertexNormal); // Scale gak rata (body gepeng)
+        gl_Position = mvp * model * vec4(vertexPosition, 1.0);
+    }
+)";
+
 // Fragment Shader: STOCHASTIC TILING + RANDOM ROTATION
 inline const char* FS_GROUND_CODE = R"(
     #version 330
     in vec3 fragPosition;
     in vec2 fragTexCoord;
     in vec3 fragNormal;
+    in vec4 fragColor;
 
     uniform sampler2D texture0;
     uniform vec4 colDiffuse;
@@ -101,8 +138,9 @@ inline const char* FS_GROUND_CODE = R"(
         float diff = max(dot(norm, lightDir), 0.0);
         vec3 diffuse = diff * vec3(1.0, 1.0, 0.9);
 
-        vec3 result = (ambient + diffuse) * colDiffuse.rgb * texelColor.rgb;
-        finalColor = vec4(result, colDiffuse.a * texelColor.a);
+        vec4 tint = colDiffuse * fragColor;
+        vec3 result = (ambient + diffuse) * tint.rgb * texelColor.rgb;
+        finalColor = vec4(result, tint.a * texelColor.a);
     }
 )";
 
@@ -110,6 +148,7 @@ inline const char* FS_SLIME_CODE = R"(
     #version 330
     in vec3 fragPosition;
     in vec3 fragNormal;
+    in vec4 fragColor;
 
     uniform vec4 colDiffuse; 
     uniform vec3 lightPos;
@@ -129,7 +168,7 @@ inline const char* FS_SLIME_CODE = R"(
         // --- 2. BODY COLOR (KABUT) ---
         // Trik: Campur warna dasar dengan sedikit putih (0.2) biar jadi 'Milky/Cloudy'
         // Ini biar box di dalem gak kelihatan HD banget
-        vec3 foggyBody = mix(colDiffuse.rgb, vec3(0.8, 0.9, 1.0), 0.3); 
+        vec3 foggyBody = mix(colDiffuse.rgb * fragColor.rgb, vec3(0.8, 0.9, 1.0), 0.3); 
         
         // Rim Color (Putih terang)
         vec3 rimColor = vec3(1.0, 1.0, 1.0) * fresnel * 2.0;
@@ -144,4 +183,92 @@ inline const char* FS_SLIME_CODE = R"(
 
         finalColor = vec4(finalRGB, min(alpha, 1.0));
     }
-)";
\ No newline at end of file
+)";
+// 💎 XP GEM (instanced). CPU cuma nulis 2 vec4 per gem (lihat InstanceBatch::AddData):
+//   instanceTransform[0] = (posisi xyz, ukuran), instanceTransform[1].x = seed fase
+// Bob, spin, & kedip kuning/hijau dihitung di sini dari uniform time.
+inline const char* VS_GEM_CODE = R"(
+    #version 330
+    layout(location = 0) in vec3 vertexPosition;
+    layout(location = 1) in vec2 vertexTexCoord;
+    in mat4 instanceTransform;
+
+    uniform mat4 mvp;
+    uniform float time;
+
+    out vec2 fragTexCoord;
+    out vec4 fragColor;
+
+    void main() {
+        vec4 posSize = instanceTransform[0];
+        float seed = instanceTransform[1].x;
+
+        // Miring 45 derajat di X, lalu muter di Y (150 derajat/detik)
+        float tilt = radians(45.0);
+        float spin = radians(time * 150.0);
+        vec3 p = vertexPosition * posSize.w;
+        p = vec3(p.x, p.y * cos(tilt) - p.z * sin(tilt), p.y * sin(tilt) + p.z * cos(tilt));
+        p = vec3(p.x * cos(spin) + p.z * sin(spin), p.y, -p.x * sin(spin) + p.z * cos(spin));
+
+        float bob = sin(time * 8.0 + seed) * 0.15;
+        vec3 world = posSize.xyz + vec3(0.0, 0.3 + bob, 0.0) + p;
+
+        // YELLOW / GREEN raylib, gantian ngikutin sinyal
+        fragColor = (sin(time * 3.0 + seed) > 0.0) ? vec4(0.992, 0.976, 0.0, 1.0) : vec4(0.0, 0.894, 0.188, 1.0);
+        fragTexCoord = vertexTexCoord;
+        gl_Position = mvp * vec4(world, 1.0);
+    }
+)";
+
+// Pinggiran tiap sisi kubus (UV dekat 0/1) = putih, pengganti DrawCubeWires
+inline const char* FS_GEM_CODE = R"(
+    #version 330
+    in vec2 fragTexCoord;
+    in vec4 fragColor;
+
+    out vec4 finalColor;
+
+    void main() {
+        vec2 edge = min(fragTexCoord, 1.0 - fragTexCoord);
+        float wire = step(min(edge.x, edge.y), 0.06);
+        finalColor = mix(fragColor, vec4(1.0), wire);
+    }
+)";
+
+// ✨ PARTIKEL (instanced). CPU nulis 2 vec4 per partikel (lihat ParticleSystem::DrawInstanced):
+//   instanceTransform[0] = (posisi xyz, ukuran), instanceTransform[1] = RGBA (0..1, alpha udah fade)
+// billboard = 0 -> mesh kubus apa adanya (kayak DrawCube lama)
+// billboard = 1 -> mesh plane XZ diputer ngadep kamera (camRight/camUp), 2 segitiga per partikel
+inline const char* VS_PARTICLE_CODE = R"(
+    #version 330
+    layout(location = 0) in vec3 vertexPosition;
+    in mat4 instanceTransform;
+
+    uniform mat4 mvp;
+    uniform float billboard;
+    uniform vec3 camRight;
+    uniform vec3 camUp;
+
+    out vec4 fragColor;
+
+    void main() {
+        vec4 posSize = instanceTransform[0];
+        vec3 cubeOffset = vertexPosition;
+        vec3 quadOffset = camRight * vertexPosition.x - camUp * vertexPosition.z;
+        vec3 world = posSize.xyz + mix(cubeOffset, quadOffset, billboard) * posSize.w;
+
+        fragColor = instanceTransform[1];
+        gl_Position = mvp * vec4(world, 1.0);
+    }
+)";
+
+inline const char* FS_PARTICLE_CODE = R"(
+    #version 330
+    in vec4 fragColor;
+
+    out vec4 finalColor;
+
+    void main() {
+        finalColor = fragColor;
+    }
+)";
@@ -0,0 +1,236 @@
+#include "AssetPack.h"
+#include "Lz4.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+static uint32_t AlignUp(uint32_t value) {
+    return (value + ASSET_PACK_ALIGN - 1) & ~(ASSET_PACK_ALIGN - 1);
+}
+
+// --- WRITER ---
+
+void AssetPackWriter::AddEntry(const std::string& name, AssetPackKind kind, const unsigned char* data, int size, int64_t sourceModTime, bool allowCompression) {
+    PendingEntry entry;
+    entry.name = name;
+    entry.kind = kind;
+    entry.codec = AssetPackCodec::NONE;
+    entry.rawSize = (uint32_t)size;
+    entry.sourceModTime = sourceModTime;
+    entry.bytes.assign(data, data + size);
+
+    if (allowCompression && size > 0) {
+        std::vector<unsigned char> packed(Lz4CompressBound(size));
+        int packedSize = Lz4Compress(data, size, packed.data(), (int)packed.size());
+        if (packedSize > 0 && packedSize <= size - size / 8) {
+            packed.resize(packedSize);
+            entry.bytes.swap(packed);
+            entry.codec = AssetPackCodec::LZ4;
+        }
+    }
+
+    // Nama sama = timpa
+    for (auto& existing : mEntries) {
+        if (existing.name == name) {
+            existing = entry;
+            return;
+        }
+    }
+    mEntries.push_back(entry);
+}
+
+void AssetPackWriter::AddFile(const std::string& name, const unsigned char* data, int size, int64_t sourceModTime, bool allowCompression) {
+    AddEntry(name, AssetPackKind::FILE, data, size, sourceModTime, allowCompression);
+}
+
+void AssetPackWriter::AddMesh(const std::string& name, const Mesh& mesh) {
+    AssetPackMesh header;
+    memset(&header, 0, sizeof(header));
+    header.vertexCount = mesh.vertexCount;
+    header.triangleCount = mesh.triangleCount;
+    header.hasTexcoords = mesh.texcoords != nullptr;
+    header.hasNormals = mesh.normals != nullptr;
+    header.hasIndices = mesh.indices != nullptr;
+
+    std::vector<unsigned char> bytes(sizeof(header));
+    memcpy(bytes.data(), &header, sizeof(header));
+    auto append = [&bytes](const void* src, size_t size) {
+        size_t at = bytes.size();
+        bytes.resize(at + size);
+        memcpy(&bytes[at], src, size);
+    };
+    append(mesh.vertices, (size_t)mesh.vertexCount * 3 * sizeof(float));
+    if (header.hasTexcoords) append(mesh.texcoords, (size_t)mesh.vertexCount * 2 * sizeof(float));
+    if (header.hasNormals) append(mesh.normals, (size_t)mesh.vertexCount * 3 * sizeof(float));
+    if (header.hasIndices) append(mesh.indices, (size_t)mesh.triangleCount * 3 * sizeof(unsigned short));
+
+    AddEntry(name, AssetPackKind::MESH, bytes.data(), (int)bytes.size(), 0, true);
+}
+
+size_t AssetPackWriter::RawBytes() const {
+    size_t total = 0;
+    for (const auto& entry : mEntries) total += entry.rawSize;
+    return total;
+}
+
+size_t AssetPackWriter::StoredBytes() const {
+    size_t total = 0;
+    for (const auto& entry : mEntries) total += entry.bytes.size();
+    return total;
+}
+
+bool AssetPackWriter::Write(const char* path) {
+    // Urut nama -> runtime bisa binary search
+    std::sort(mEntries.begin(), mEntries.end(),
+        [](const PendingEntry& a, const PendingEntry& b) { return a.name < b.name; });
+
+    AssetPackHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic = ASSET_PACK_MAGIC;
+    header.version = ASSET_PACK_VERSION;
+    header.entryCount = (uint32_t)mEntries.size();
+    header.entriesOffset = AlignUp(sizeof(AssetPackHeader));
+
+    std::vector<AssetPackEntry> table(mEntries.size());
+    uint32_t cursor = header.entriesOffset + (uint32_t)(table.size() * sizeof(AssetPackEntry));
+    for (size_t i = 0; i < mEntries.size(); i++) {
+        const PendingEntry& pending = mEntries[i];
+        if (pending.name.size() >= (size_t)ASSET_PACK_NAME_SIZE) return false;
+
+        AssetPackEntry& entry = table[i];
+        memset(&entry, 0, sizeof(entry));
+        memcpy(entry.name, pending.name.c_str(), pending.name.size());
+        entry.kind = pending.kind;
+        entry.codec = pending.codec;
+        entry.offset = AlignUp(cursor);
+        entry.storedSize = (uint32_t)pending.bytes.size();
+        entry.rawSize = pending.rawSize;
+        entry.sourceModTime = pending.sourceModTime;
+        cursor = entry.offset + entry.storedSize;
+    }
+    header.fileSize = AlignUp(cursor);
+
+    // Rakit di memori dulu (padding otomatis 0), baru tulis sekali
+    std::vector<unsigned char> bytes(header.fileSize, 0);
+    memcpy(bytes.data(), &header, sizeof(header));
+    if (!table.empty()) memcpy(&bytes[header.entriesOffset], table.data(), table.size() * sizeof(AssetPackEntry));
+    for (size_t i = 0; i < mEntries.size(); i++) {
+        if (!mEntries[i].bytes.empty()) memcpy(&bytes[table[i].offset], mEntries[i].bytes.data(), mEntries[i].bytes.size());
+    }
+
+    FILE* file = fopen(path, "wb");
+    if (file == nullptr) return false;
+    bool ok = fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size();
+    ok = (fclose(file) == 0) && ok;
+    return ok;
+}
+
+// --- VIEW (mmap) ---
+
+bool AssetPackView::Open(const char* path) {
+    Close();
+    if (!mFile.Open(path)) return false;
+
+    if (mFile.Size() < sizeof(AssetPackHeader)) {
+        Close();
+        return false;
+    }
+    const AssetPackHeader* header = (const AssetPackHeader*)mFile.Data();
+    bool valid = header->magic == ASSET_PACK_MAGIC
+        && header->version == ASSET_PACK_VERSION
+        && header->fileSize == mFile.Size()
+        && header->entriesOffset % ASSET_PACK_ALIGN == 0
+        && (size_t)header->entriesOffset + (size_t)header->entryCount * sizeof(AssetPackEntry) <= mFile.Size();
+
+    const AssetPackEntry* entries = (const AssetPackEntry*)(mFile.Data() + header->entriesOffset);
+    for (uint32_t i = 0; valid && i < header->entryCount; i++) {
+        const AssetPackEntry& entry = entries[i];
+        valid = memchr(entry.name, 0, ASSET_PACK_NAME_SIZE) != nullptr
+            && (entry.kind == AssetPackKind::FILE || entry.kind == AssetPackKind::MESH)
+            && (entry.codec == AssetPackCodec::NONE || entry.codec == AssetPackCodec::LZ4)
+            && (entry.codec != AssetPackCodec::NONE || entry.storedSize == entry.rawSize)
+            && entry.offset % ASSET_PACK_ALIGN == 0
+            && (size_t)entry.offset + entry.storedSize <= mFile.Size()
+            && entry.rawSize <= 0x7FFFFFFF
+            && (i == 0 || strcmp(entries[i - 1].name, entry.name) < 0); // Wajib urut (binary search)
+    }
+
+    if (!valid) {
+        Close();
+        return false;
+    }
+    mHeader = header;
+    mEntries = entries;
+    return true;
+}
+
+void AssetPackView::Close() {
+    mFile.Close();
+    mHeader = nullptr;
+    mEntries = nullptr;
+}
+
+const AssetPackEntry* AssetPackView::Find(const std::string& name) const {
+    if (mHeader == nullptr) return nullptr;
+    const AssetPackEntry* begin = mEntries;
+    const AssetPackEntry* end = mEntries + mHeader->entryCount;
+    const AssetPackEntry* it = std::lower_bound(begin, end, name,
+        [](const AssetPackEntry& entry, const std::string& key) { return strcmp(entry.name, key.c_str()) < 0; });
+    if (it == end || name != it->name) return nullptr;
+    return it;
+}
+
+bool AssetPackView::Read(const AssetPackEntry& entry, const unsigned char** outData, int* outSize, unsigned char** outOwned) const {
+    const unsigned char* blob = mFile.Data() + entry.offset;
+    *outOwned = nullptr;
+
+    if (entry.codec == AssetPackCodec::NONE) {
+        *outData = blob;
+        *outSize = (int)entry.rawSize;
+        return true;
+    }
+
+    unsigned char* raw = (unsigned char*)MemAlloc(entry.rawSize > 0 ? entry.rawSize : 1);
+    int size = Lz4Decompress(blob, (int)entry.storedSize, raw, (int)entry.rawSize);
+    if (size != (int)entry.rawSize) {
+        MemFree(raw);
+        return false;
+    }
+    *outData = raw;
+    *outSize = size;
+    *outOwned = raw;
+    return true;
+}
+
+// --- MESH ---
+
+bool DecodePackedMesh(const unsigned char* data, int size, Mesh& out) {
+    out = Mesh{ 0 };
+    if (size < (int)sizeof(AssetPackMesh)) return false;
+
+    AssetPackMesh header;
+    memcpy(&header, data, sizeof(header));
+    if (header.vertexCount <= 0 || header.triangleCount <= 0) return false;
+
+    size_t vertexBytes = (size_t)header.vertexCount * 3 * sizeof(float);
+    size_t texcoordBytes = header.hasTexcoords ? (size_t)header.vertexCount * 2 * sizeof(float) : 0;
+    size_t normalBytes = header.hasNormals ? (size_t)header.vertexCount * 3 * sizeof(float) : 0;
+    size_t indexBytes = header.hasIndices ? (size_t)header.triangleCount * 3 * sizeof(unsigned short) : 0;
+    if (sizeof(header) + vertexBytes + texcoordBytes + normalBytes + indexBytes != (size_t)size) return false;
+
+    const unsigned char* cursor = data + sizeof(header);
+    auto take = [&cursor](size_t bytes) -> void* {
+        if (bytes == 0) return nullptr;
+        void* array = MemAlloc((unsigned int)bytes);
+        memcpy(array, cursor, bytes);
+        cursor += bytes;
+        return array;
+    };
+    out.vertexCount = header.vertexCount;
+    out.triangleCount = header.triangleCount;
+    out.vertices = (float*)take(vertexBytes);
+    out.texcoords = (float*)take(texcoordBytes);
+    out.normals = (float*)take(normalBytes);
+    out.indices = (unsigned short*)take(indexBytes);
+    return true;
+}
@@ -0,0 +1,108 @@
+#pragma once
+#include "raylib.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "MappedFile.h"
+
+// 📦 ASSET PACK (.mbpk) - semua aset game dalam 1 file (Tools/AssetPacker)
+// Cold start cukup 1 open + mmap, worker baca blob berurutan, gak ada open/seek per file.
+//
+// Layout: [AssetPackHeader][AssetPackEntry x N, urut nama][blob...]. Blob rata 64 byte, little-endian.
+// Blob FILE = isi file asli (glb/png/mp3), blob MESH = array vertex mentah hasil GenMesh* (tinggal upload).
+// Entry FILE nyimpen ukuran (rawSize) + mtime file sumbernya: file lepas yang beda = pack basi, file lepas menang.
+constexpr uint32_t ASSET_PACK_MAGIC = 0x4B50424D; // "MBPK"
+constexpr uint32_t ASSET_PACK_VERSION = 2;
+constexpr uint32_t ASSET_PACK_ALIGN = 64;
+constexpr int ASSET_PACK_NAME_SIZE = 96;
+
+enum class AssetPackKind : uint32_t {
+    FILE = 0,
+    MESH = 1
+};
+
+enum class AssetPackCodec : uint32_t {
+    NONE = 0, // Blob = data asli (bisa langsung dipakai dari mmap)
+    LZ4 = 1   // Blob = LZ4 block, didekompres ke buffer baru
+};
+
+struct AssetPackHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t entryCount;
+    uint32_t entriesOffset;
+    uint32_t fileSize;   // Buat deteksi file kepotong
+    uint32_t reserved[3];
+};
+
+struct AssetPackEntry {
+    char name[ASSET_PACK_NAME_SIZE]; // Path relatif game ("Resources/Models/Chicken.glb") / "mesh/cube"
+    AssetPackKind kind;
+    AssetPackCodec codec;
+    uint32_t offset;     // Byte dari awal file
+    uint32_t storedSize; // Ukuran di file
+    uint32_t rawSize;    // Ukuran setelah dekompres (FILE: = ukuran file sumber)
+    uint32_t reserved;
+    int64_t sourceModTime; // GetFileModTime file sumber pas di-pack (MESH: 0)
+};
+
+// Header blob MESH, diikuti vertices (3 float), texcoords (2 float), normals (3 float), indices (3 ushort / segitiga)
+struct AssetPackMesh {
+    int32_t vertexCount;
+    int32_t triangleCount;
+    uint32_t hasTexcoords;
+    uint32_t hasNormals;
+    uint32_t hasIndices;
+    uint32_t reserved[3];
+};
+
+// Tool offline: kumpulin entry, Write() urutin nama + tulis sekali
+class AssetPackWriter {
+public:
+    // LZ4 cuma dipakai kalau hasilnya hemat >= 1/8 (mp3/png udah terkompres, biasanya tetap NONE)
+    void AddFile(const std::string& name, const unsigned char* data, int size, int64_t sourceModTime, bool allowCompression = true);
+    void AddMesh(const std::string& name, const Mesh& mesh); // Cuma array CPU, gak nyentuh GPU
+    bool Write(const char* path);
+
+    int Count() const { return (int)mEntries.size(); }
+    size_t RawBytes() const;
+    size_t StoredBytes() const;
+
+private:
+    struct PendingEntry {
+        std::string name;
+        AssetPackKind kind;
+        AssetPackCodec codec;
+        uint32_t rawSize;
+        int64_t sourceModTime;
+        std::vector<unsigned char> bytes; // Yang beneran ditulis (udah dikompres kalau LZ4)
+    };
+    void AddEntry(const std::string& name, AssetPackKind kind, const unsigned char* data, int size, int64_t sourceModTime, bool allowCompression);
+
+    std::vector<PendingEntry> mEntries;
+};
+
+// File .mbpk yang di-mmap. Read-only setelah Open -> aman dibaca dari worker thread
+class AssetPackView {
+public:
+    AssetPackView() : mHeader(nullptr), mEntries(nullptr) {}
+
+    bool Open(const char* path); // false = gak ada / header atau entry gak valid
+    void Close();
+    bool IsOpen() const { return mHeader != nullptr; }
+    int Count() const { return mHeader != nullptr ? (int)mHeader->entryCount : 0; }
+
+    const AssetPackEntry* Find(const std::string& name) const; // Binary search, nullptr = gak ada
+
+    // Isi entry. NONE = pointer langsung ke mmap (outOwned nullptr),
+    // LZ4 = buffer MemAlloc baru di outOwned (wajib MemFree). false = blob rusak
+    bool Read(const AssetPackEntry& entry, const unsigned char** outData, int* outSize, unsigned char** outOwned) const;
+
+private:
+    MappedFile mFile;
+    const AssetPackHeader* mHeader;
+    const AssetPackEntry* mEntries;
+};
+
+// Blob MESH -> Mesh dengan array CPU (MemAlloc) siap UploadMesh. false = ukuran gak cocok
+bool DecodePackedMesh(const unsigned char* data, int size, Mesh& out);
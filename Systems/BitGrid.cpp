@@ -0,0 +1,55 @@
+#include "BitGrid.h"
+
+void BitGrid::Resize(int width, int height) {
+    mWidth = (width > 0) ? width : 0;
+    mHeight = (height > 0) ? height : 0;
+    mWordsPerRow = (mWidth + 63) >> 6;
+    mWords.assign((size_t)mWordsPerRow * mHeight, 0);
+    mExternal = nullptr;
+}
+
+void BitGrid::Attach(const uint64_t* words, int width, int height) {
+    mWidth = (width > 0) ? width : 0;
+    mHeight = (height > 0) ? height : 0;
+    mWordsPerRow = (mWidth + 63) >> 6;
+    mWords.clear();
+    mExternal = words;
+}
+
+void BitGrid::Clear() {
+    for (auto& w : mWords) w = 0; // Grid attach (read-only) gak kesentuh
+}
+
+bool BitGrid::AnyInRect(int x0, int y0, int x1, int y1) const {
+    if (x0 > x1 || y0 > y1) return false;
+
+    int w0 = x0 >> 6;
+    int w1 = x1 >> 6;
+    // Mask bit pertama & terakhir (sisanya word penuh)
+    uint64_t firstMask = ~(uint64_t)0 << (x0 & 63);
+    uint64_t lastMask = ~(uint64_t)0 >> (63 - (x1 & 63));
+
+    for (int y = y0; y <= y1; y++) {
+        const uint64_t* row = Words() + (size_t)y * mWordsPerRow;
+        if (w0 == w1) {
+            if (row[w0] & firstMask & lastMask) return true;
+            continue;
+        }
+        if (row[w0] & firstMask) return true;
+        for (int w = w0 + 1; w < w1; w++) {
+            if (row[w]) return true;
+        }
+        if (row[w1] & lastMask) return true;
+    }
+    return false;
+}
+
+int BitGrid::CountSet() const {
+    int count = 0;
+    const uint64_t* words = Words();
+    for (int i = 0; i < WordCount(); i++) {
+        uint64_t w = words[i];
+        for (; w != 0; w &= w - 1) count++; // Buang bit terendah tiap iterasi
+    }
+    return count;
+}
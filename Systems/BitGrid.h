@@ -0,0 +1,44 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// 🧱 BIT GRID (1 bit per cell, 64 cell per word)
+// Dipakai LevelManager buat occupancy collision map: 512x512 = 8 word per baris = 32 KB total,
+// muat di L1/L2. Query titik = 1 shift + AND, query kotak = mask per baris (bukan per pixel).
+// Koordinat di luar grid gak dicek di sini (pemanggil yang mutusin artinya: tembok / kosong).
+//
+// 2 mode: punya memori sendiri (Resize + Set, dipakai pas compile) atau Attach ke word
+// read-only di luar (file level yang di-mmap). Set/Reset/Clear cuma buat mode pertama.
+class BitGrid {
+public:
+    BitGrid() : mWidth(0), mHeight(0), mWordsPerRow(0), mExternal(nullptr) {}
+
+    void Resize(int width, int height); // Semua bit di-reset ke 0
+    void Attach(const uint64_t* words, int width, int height); // Gak di-copy, pemanggil jaga umurnya
+    void Clear();
+
+    void Set(int x, int y) { mWords[Index(x, y)] |= Bit(x); }
+    void Reset(int x, int y) { mWords[Index(x, y)] &= ~Bit(x); }
+    bool Test(int x, int y) const { return (Words()[Index(x, y)] & Bit(x)) != 0; }
+
+    // Ada bit 1 di kotak [x0..x1] x [y0..y1] (inklusif, udah di-clamp pemanggil)?
+    bool AnyInRect(int x0, int y0, int x1, int y1) const;
+
+    int Width() const { return mWidth; }
+    int Height() const { return mHeight; }
+    int CountSet() const;
+    int WordCount() const { return mWordsPerRow * mHeight; }
+    size_t ByteSize() const { return (size_t)WordCount() * sizeof(uint64_t); }
+    const uint64_t* Words() const { return mExternal ? mExternal : mWords.data(); }
+
+private:
+    int Index(int x, int y) const { return y * mWordsPerRow + (x >> 6); }
+    static uint64_t Bit(int x) { return (uint64_t)1 << (x & 63); }
+
+    int mWidth;
+    int mHeight;
+    int mWordsPerRow;
+    std::vector<uint64_t> mWords;
+    const uint64_t* mExternal;
+};
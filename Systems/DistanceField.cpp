@@ -0,0 +1,172 @@
+#include "DistanceField.h"
+#include "BitGrid.h"
+#include <cmath>
+
+static const float EDT_INF = 1e20f;
+
+// Squared distance transform 1D (Felzenszwalb & Huttenlocher): f[i] = 0 di fitur, INF di luar.
+// Hasil d[i] = min_j (i - j)^2 + f[j]. v / z = scratch (n & n+1)
+static void DistanceTransform1D(const float* f, float* d, int n, int* v, float* z) {
+    int k = 0;
+    v[0] = 0;
+    z[0] = -EDT_INF;
+    z[1] = EDT_INF;
+    for (int q = 1; q < n; q++) {
+        float s = ((f[q] + q * q) - (f[v[k]] + v[k] * v[k])) / (2.0f * q - 2.0f * v[k]);
+        while (s <= z[k]) {
+            k--;
+            s = ((f[q] + q * q) - (f[v[k]] + v[k] * v[k])) / (2.0f * q - 2.0f * v[k]);
+        }
+        k++;
+        v[k] = q;
+        z[k] = s;
+        z[k + 1] = EDT_INF;
+    }
+    k = 0;
+    for (int q = 0; q < n; q++) {
+        while (z[k + 1] < q) k++;
+        float dq = (float)(q - v[k]);
+        d[q] = dq * dq + f[v[k]];
+    }
+}
+
+// 2D = 1D per kolom lalu 1D per baris. grid: 0 = fitur, INF = bukan (ditimpa jadi jarak^2)
+static void DistanceTransform2D(std::vector<float>& grid, int w, int h) {
+    int n = (w > h) ? w : h;
+    std::vector<float> f(n), d(n), z(n + 1);
+    std::vector<int> v(n);
+
+    for (int x = 0; x < w; x++) {
+        for (int y = 0; y < h; y++) f[y] = grid[y * w + x];
+        DistanceTransform1D(f.data(), d.data(), h, v.data(), z.data());
+        for (int y = 0; y < h; y++) grid[y * w + x] = d[y];
+    }
+    for (int y = 0; y < h; y++) {
+        DistanceTransform1D(&grid[y * w], d.data(), w, v.data(), z.data());
+        for (int x = 0; x < w; x++) grid[y * w + x] = d[x];
+    }
+}
+
+DistanceField::DistanceField()
+    : mWidth(0), mHeight(0), mWorldSize(0.0f), mPixelsPerUnit(0.0f), mUnitsPerPixel(0.0f), mExternal(nullptr) {}
+
+void DistanceField::Clear() {
+    mWidth = 0;
+    mHeight = 0;
+    mDistances.clear();
+    mExternal = nullptr;
+}
+
+void DistanceField::SetDimensions(int width, int height, float worldSize) {
+    mWidth = width;
+    mHeight = height;
+    mWorldSize = worldSize;
+    mPixelsPerUnit = width / worldSize;
+    mUnitsPerPixel = worldSize / width;
+}
+
+void DistanceField::Attach(const float* distances, int width, int height, float worldSize) {
+    if (distances == nullptr || width <= 0 || height <= 0 || worldSize <= 0.0f) {
+        Clear();
+        return;
+    }
+    SetDimensions(width, height, worldSize);
+    mDistances.clear();
+    mExternal = distances;
+}
+
+void DistanceField::Bake(const BitGrid& solid, float worldSize) {
+    int w = solid.Width();
+    int h = solid.Height();
+    if (w <= 0 || h <= 0 || worldSize <= 0.0f) {
+        Clear();
+        return;
+    }
+
+    SetDimensions(w, h, worldSize);
+    mExternal = nullptr;
+
+    // Grid dipadding 1 pixel tembok di semua sisi (luar map = void)
+    int pw = w + 2;
+    int ph = h + 2;
+    std::vector<float> toSolid(pw * ph), toFree(pw * ph);
+    for (int y = 0; y < ph; y++) {
+        for (int x = 0; x < pw; x++) {
+            bool isSolid = (x == 0 || y == 0 || x == pw - 1 || y == ph - 1) || solid.Test(x - 1, y - 1);
+            toSolid[y * pw + x] = isSolid ? 0.0f : EDT_INF;
+            toFree[y * pw + x] = isSolid ? EDT_INF : 0.0f;
+        }
+    }
+    DistanceTransform2D(toSolid, pw, ph);
+    DistanceTransform2D(toFree, pw, ph);
+
+    // Jarak antar pusat pixel - 0.5 = jarak ke pinggir pixel (batas tembok)
+    mDistances.resize(w * h);
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            int p = (y + 1) * pw + (x + 1);
+            float pixels = (toSolid[p] > 0.0f) ? sqrtf(toSolid[p]) - 0.5f : -(sqrtf(toFree[p]) - 0.5f);
+            mDistances[y * w + x] = pixels * mUnitsPerPixel;
+        }
+    }
+}
+
+float DistanceField::PixelValue(int x, int y) const {
+    int cx = (x < 0) ? 0 : ((x >= mWidth) ? mWidth - 1 : x);
+    int cy = (y < 0) ? 0 : ((y >= mHeight) ? mHeight - 1 : y);
+    float value = Data()[cy * mWidth + cx];
+    if (cx == x && cy == y) return value;
+
+    // Di luar map: makin jauh makin dalam di void
+    float outside = (float)((x - cx) * (x - cx) + (y - cy) * (y - cy));
+    float voidDepth = -sqrtf(outside) * mUnitsPerPixel;
+    return (value < voidDepth) ? value : voidDepth;
+}
+
+float DistanceField::Sample(Vector3 pos) const {
+    if (mWidth == 0) return EDT_INF;
+
+    // World -> koordinat pixel (pusat pixel i ada di i + 0.5)
+    float half = mWorldSize * 0.5f;
+    float fx = (pos.x + half) * mPixelsPerUnit - 0.5f;
+    float fy = (pos.z + half) * mPixelsPerUnit - 0.5f;
+    float floorX = floorf(fx);
+    float floorY = floorf(fy);
+    int x0 = (int)floorX;
+    int y0 = (int)floorY;
+    float tx = fx - floorX;
+    float ty = fy - floorY;
+
+    float a = PixelValue(x0, y0);
+    float b = PixelValue(x0 + 1, y0);
+    float c = PixelValue(x0, y0 + 1);
+    float d = PixelValue(x0 + 1, y0 + 1);
+    float top = a + (b - a) * tx;
+    float bottom = c + (d - c) * tx;
+    return top + (bottom - top) * ty;
+}
+
+Vector3 DistanceField::Normal(Vector3 pos) const {
+    if (mWidth == 0) return { 0.0f, 0.0f, 0.0f };
+
+    float e = mUnitsPerPixel;
+    float dx = Sample({ pos.x + e, pos.y, pos.z }) - Sample({ pos.x - e, pos.y, pos.z });
+    float dz = Sample({ pos.x, pos.y, pos.z + e }) - Sample({ pos.x, pos.y, pos.z - e });
+    float len = sqrtf(dx * dx + dz * dz);
+    if (len < 1e-6f) return { 0.0f, 0.0f, 0.0f };
+    return { dx / len, 0.0f, dz / len };
+}
+
+Vector3 DistanceField::PushOut(Vector3 pos, float radius) const {
+    // Maks 3 langkah (pojok dalam bisa butuh 2 dorongan dari 2 tembok)
+    for (int i = 0; i < 3; i++) {
+        float dist = Sample(pos);
+        if (dist >= radius) break;
+        Vector3 n = Normal(pos);
+        if (n.x == 0.0f && n.z == 0.0f) break; // Di tengah tembok tebel / pojok simetris
+        float push = radius - dist;
+        pos.x += n.x * push;
+        pos.z += n.z * push;
+    }
+    return pos;
+}
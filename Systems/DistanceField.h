@@ -0,0 +1,47 @@
+#pragma once
+#include "raylib.h"
+#include <vector>
+
+class BitGrid;
+
+// 📐 SIGNED DISTANCE FIELD (bidang XZ)
+// Di-bake sekali dari layer solid collision map: tiap pixel nyimpen jarak (world unit) ke
+// pinggir tembok terdekat. Positif = ruang kosong, negatif = di dalam tembok / void.
+// Luar map dianggap tembok (sama kayak IsPixelCollision).
+//
+// Semua query O(1): Sample = bilinear 4 pixel, Normal = beda tengah 4 sample.
+// Jadi lingkaran vs tembok, vektor dorong keluar, & normal buat sliding gak perlu probe banyak pixel.
+class DistanceField {
+public:
+    DistanceField();
+
+    // worldSize = sisi map di world (map nutup -worldSize/2 .. worldSize/2)
+    void Bake(const BitGrid& solid, float worldSize);
+    // Pakai jarak hasil bake offline (file level di-mmap), gak di-copy
+    void Attach(const float* distances, int width, int height, float worldSize);
+    void Clear();
+    bool IsReady() const { return mWidth > 0; }
+    int Width() const { return mWidth; }
+    int Height() const { return mHeight; }
+    const float* Data() const { return mExternal ? mExternal : mDistances.data(); }
+
+    float Sample(Vector3 pos) const;  // Jarak bertanda ke tembok terdekat (world unit)
+    Vector3 Normal(Vector3 pos) const; // Arah menjauh dari tembok (XZ, y = 0, panjang 1)
+
+    // Lingkaran (center, radius) kena tembok?
+    bool CircleBlocked(Vector3 pos, float radius) const { return Sample(pos) < radius; }
+    // Posisi lingkaran didorong keluar tembok sepanjang normal (gak berubah kalau udah aman)
+    Vector3 PushOut(Vector3 pos, float radius) const;
+
+private:
+    float PixelValue(int x, int y) const; // Luar grid = extrapolasi ke dalam void
+    void SetDimensions(int width, int height, float worldSize);
+
+    int mWidth;
+    int mHeight;
+    float mWorldSize;
+    float mPixelsPerUnit;
+    float mUnitsPerPixel;
+    std::vector<float> mDistances; // World unit, row-major (hasil Bake)
+    const float* mExternal;        // Hasil Attach
+};
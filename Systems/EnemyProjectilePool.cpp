@@ -0,0 +1,77 @@
+#include "EnemyProjectilePool.h"
+#include "raymath.h"
+
+EnemyProjectilePool::EnemyProjectilePool(int capacity)
+    : mBullets(capacity > 0 ? capacity : 1), mCount(0), mPeak(0), mDropped(0) {
+}
+
+bool EnemyProjectilePool::Spawn(const EnemyBullet& bullet) {
+    if (mCount >= (int)mBullets.size()) {
+        mDropped++;
+        return false;
+    }
+    EnemyBullet& b = mBullets[mCount++];
+    b = bullet;
+    b.prevPosition = b.position;
+    if (mCount > mPeak) mPeak = mCount;
+    return true;
+}
+
+void EnemyProjectilePool::Update(float dt) {
+    for (int i = 0; i < mCount; ) {
+        EnemyBullet& b = mBullets[i];
+        b.position = Vector3Add(b.position, Vector3Scale(b.direction, b.speed * dt));
+        b.lifeTime -= dt;
+
+        // Habis umur / kena tanah
+        if (b.lifeTime <= 0 || b.position.y <= 0) {
+            Kill(i);
+            continue;
+        }
+        i++;
+    }
+}
+
+void EnemyProjectilePool::SavePreviousState() {
+    for (int i = 0; i < mCount; i++) mBullets[i].prevPosition = mBullets[i].position;
+}
+
+void EnemyProjectilePool::Clear() {
+    mCount = 0;
+}
+
+void EnemyProjectilePool::Draw(float alpha) {
+    if (mCount == 0) return;
+
+    // --- 🔥 PELURU SHOOTER (laser glowing) ---
+    // Additive dibuka SEKALI buat semua peluru shooter (dulu buka-tutup per shooter)
+    BeginBlendMode(BLEND_ADDITIVE);
+    for (int i = 0; i < mCount; i++) {
+        const EnemyBullet& b = mBullets[i];
+        if (b.fromBoss) continue;
+
+        Vector3 pos = Vector3Lerp(b.prevPosition, b.position, alpha);
+        Color glowColor = b.color;
+        Color coreColor = WHITE;
+
+        // Ekor (trail) memanjang ke BELAKANG arah gerak peluru
+        float trailLength = 1.5f;
+        Vector3 tailPos = Vector3Subtract(pos, Vector3Scale(b.direction, trailLength));
+
+        DrawSphere(pos, b.radius * 1.2f, ColorAlpha(glowColor, 0.4f));                 // Aura luar
+        DrawCylinderEx(tailPos, pos, b.radius * 0.1f, b.radius * 0.6f, 6, glowColor); // Badan
+        DrawLine3D(tailPos, pos, coreColor);                                           // Inti laser
+        DrawSphere(pos, b.radius * 0.4f, coreColor);                                   // Spark kepala
+    }
+    EndBlendMode();
+
+    // --- 👑 PELURU BOSS (bola oranye) ---
+    for (int i = 0; i < mCount; i++) {
+        const EnemyBullet& b = mBullets[i];
+        if (!b.fromBoss) continue;
+
+        Vector3 pos = Vector3Lerp(b.prevPosition, b.position, alpha);
+        DrawSphere(pos, b.radius, ORANGE);
+        DrawSphereWires(pos, b.radius, 4, 4, RED);
+    }
+}
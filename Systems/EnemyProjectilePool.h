@@ -0,0 +1,49 @@
+#pragma once
+#include "raylib.h"
+#include <vector>
+
+// Peluru musuh (Shooter & Boss pakai struct yang sama)
+struct EnemyBullet {
+    Vector3 position;
+    Vector3 prevPosition; // Posisi tick sebelumnya (interpolasi render)
+    Vector3 direction;
+    float speed;
+    float damage;
+    float radius;
+    float lifeTime;
+    Color color;   // Glow peluru shooter (warna body yang nembak)
+    bool fromBoss; // Boss: bola oranye + efek kena lebih gede
+};
+
+// 🎯 ENEMY PROJECTILE POOL
+// Satu array kapasitas tetap buat SEMUA peluru musuh (Shooter + Boss).
+// Slot [0, Count()) = hidup semua, yang mati di-swap sama slot terakhir,
+// jadi update, collision ke player, & draw masing-masing cuma 1 loop rapat.
+// Peluru gak nempel ke yang nembak: musuh mati, pelurunya tetep terbang sampai habis.
+class EnemyProjectilePool {
+public:
+    explicit EnemyProjectilePool(int capacity = 2048);
+
+    // false = pool penuh, peluru dibuang (dihitung di Dropped())
+    bool Spawn(const EnemyBullet& bullet);
+
+    void Update(float dt); // Gerak + lifetime + kena tanah, semua peluru sekaligus
+    void Draw(float alpha = 1.0f);
+    void SavePreviousState();
+    void Clear();
+
+    // Swap-remove: slot i diisi peluru terakhir (loop yang manggil jangan i++)
+    void Kill(int i) { mBullets[i] = mBullets[--mCount]; }
+
+    EnemyBullet& operator[](int i) { return mBullets[i]; }
+    int Count() const { return mCount; }
+    int Capacity() const { return (int)mBullets.size(); }
+    int Peak() const { return mPeak; }
+    int Dropped() const { return mDropped; }
+
+private:
+    std::vector<EnemyBullet> mBullets; // Ukuran tetap = kapasitas, gak pernah resize
+    int mCount;
+    int mPeak;
+    int mDropped;
+};
@@ -0,0 +1,159 @@
+#include "FlowField.h"
+#include "../Managers/LevelManager.h"
+#include <algorithm>
+#include <cmath>
+
+static const unsigned short FLOW_UNREACHABLE = 0xFFFF;
+static const unsigned char FLOW_NO_DIR = 0xFF;
+
+// 8 arah: 4 lurus dulu (menang kalau seri), lalu diagonal
+static const int kDirX[8] = { 1, -1, 0, 0, 1, 1, -1, -1 };
+static const int kDirZ[8] = { 0, 0, 1, -1, 1, -1, 1, -1 };
+static const float kDiag = 0.70710678f;
+static const Vector3 kDirVec[8] = {
+    { 1, 0, 0 }, { -1, 0, 0 }, { 0, 0, 1 }, { 0, 0, -1 },
+    { kDiag, 0, kDiag }, { kDiag, 0, -kDiag }, { -kDiag, 0, kDiag }, { -kDiag, 0, -kDiag }
+};
+
+FlowField::FlowField(float cellSize)
+    : mCellSize(cellSize), mHasMap(false), mReady(false), mMapVersion(-1), mTargetCell(-1), mRebuildCount(0)
+{
+    mCells = (int)(COLLISION_WORLD_SIZE / cellSize);
+    mStride = mCells + 2;
+}
+
+int FlowField::CellIndex(Vector3 pos) const {
+    float halfSize = COLLISION_WORLD_SIZE / 2.0f;
+    int cx = (int)floorf((pos.x + halfSize) / mCellSize);
+    int cz = (int)floorf((pos.z + halfSize) / mCellSize);
+    if (cx < 0 || cx >= mCells || cz < 0 || cz >= mCells) return -1;
+    return (cz + 1) * mStride + (cx + 1); // Index di grid berbingkai
+}
+
+void FlowField::Update(const LevelManager& level, Vector3 targetPos) {
+    // 1. Collision map berubah -> rasterisasi ulang + paksa rebuild field
+    if (level.GetCollisionVersion() != mMapVersion) {
+        mMapVersion = level.GetCollisionVersion();
+        mHasMap = level.BuildBlockedGrid(mCells, mMapCells);
+
+        mBlocked.assign(mStride * mStride, 1);
+        for (int cz = 0; cz < mCells; cz++) {
+            for (int cx = 0; cx < mCells; cx++) {
+                mBlocked[(cz + 1) * mStride + (cx + 1)] = mMapCells[cz * mCells + cx];
+            }
+        }
+        mTargetCell = -1;
+    }
+
+    int targetCell = mHasMap ? CellIndex(targetPos) : -1;
+    if (targetCell < 0) {
+        mReady = false;
+        mTargetCell = -1;
+        return;
+    }
+
+    // 2. Player masih di cell yang sama -> field lama masih valid
+    if (targetCell == mTargetCell) return;
+    RebuildField(targetCell);
+}
+
+void FlowField::RebuildField(int targetCell) {
+    int total = mStride * mStride;
+    mDistance.assign(total, FLOW_UNREACHABLE);
+    mDirection.assign(total, FLOW_NO_DIR);
+    mQueue.resize(total);
+
+    int offset[8];
+    for (int d = 0; d < 8; d++) offset[d] = kDirZ[d] * mStride + kDirX[d];
+
+    // 1. BFS 4-arah dari cell player (cell player tetap jadi sumber walau ketutup tembok).
+    //    Bingkai tembok = gak ada cek batas di loop ini
+    int head = 0, tail = 0;
+    mDistance[targetCell] = 0;
+    mQueue[tail++] = targetCell;
+
+    while (head < tail) {
+        int cell = mQueue[head++];
+        unsigned short next = mDistance[cell] + 1;
+
+        for (int d = 0; d < 4; d++) {
+            int n = cell + offset[d];
+            if (mBlocked[n] || mDistance[n] != FLOW_UNREACHABLE) continue;
+            mDistance[n] = next;
+            mQueue[tail++] = n;
+        }
+    }
+
+    // 2. Arah tiap cell = tetangga (8 arah) dengan jarak terkecil.
+    //    Diagonal cuma boleh kalau 2 sisi lurusnya kosong (gak motong pojok tembok)
+    for (int i = 0; i < tail; i++) {
+        int cell = mQueue[i];
+        unsigned short best = mDistance[cell];
+        unsigned char bestDir = FLOW_NO_DIR;
+
+        for (int d = 0; d < 8; d++) {
+            if (d >= 4 && (mBlocked[cell + kDirX[d]] || mBlocked[cell + kDirZ[d] * mStride])) continue;
+
+            unsigned short dist = mDistance[cell + offset[d]];
+            if (dist < best) {
+                best = dist;
+                bestDir = (unsigned char)d;
+            }
+        }
+        mDirection[cell] = bestDir;
+    }
+
+    mTargetCell = targetCell;
+    mReady = true;
+    mRebuildCount++;
+}
+
+bool FlowField::SampleDirection(Vector3 pos, Vector3& outDir) const {
+    if (!mReady) return false;
+
+    int cell = CellIndex(pos);
+    if (cell < 0) return false;
+
+    // Udah 1 cell dari player: kejar lurus aja (biar gak zig-zag di grid)
+    if (mDistance[cell] <= 1) return false;
+
+    unsigned char dir = mDirection[cell];
+    if (dir == FLOW_NO_DIR) return false;
+
+    outDir = kDirVec[dir];
+    return true;
+}
+
+bool FlowField::SampleEscape(Vector3 pos, Vector3& outDir) const {
+    if (!mReady) return false;
+
+    int cell = CellIndex(pos);
+    if (cell < 0 || !mBlocked[cell]) return false;
+
+    // Tetangga kosong yang center-nya paling deket (seri -> yang lebih deket ke player)
+    float halfSize = COLLISION_WORLD_SIZE / 2.0f;
+    int cx = cell % mStride - 1;
+    int cz = cell / mStride - 1;
+    float bestDistSq = 1e30f;
+    Vector3 bestDir = { 0, 0, 0 };
+    unsigned short bestSteps = FLOW_UNREACHABLE;
+
+    for (int d = 0; d < 8; d++) {
+        int n = cell + kDirZ[d] * mStride + kDirX[d];
+        if (mBlocked[n] || mDistance[n] == FLOW_UNREACHABLE) continue;
+
+        float dx = (cx + kDirX[d] + 0.5f) * mCellSize - halfSize - pos.x;
+        float dz = (cz + kDirZ[d] + 0.5f) * mCellSize - halfSize - pos.z;
+        float distSq = dx * dx + dz * dz;
+        if (distSq < bestDistSq || (distSq == bestDistSq && mDistance[n] < bestSteps)) {
+            bestDistSq = distSq;
+            bestSteps = mDistance[n];
+            bestDir = { dx, 0, dz };
+        }
+    }
+    if (bestSteps == FLOW_UNREACHABLE || bestDistSq <= 0.0f) return false;
+
+    float invLen = 1.0f / sqrtf(bestDistSq);
+    outDir = { bestDir.x * invLen, 0.0f, bestDir.z * invLen };
+    return true;
+}
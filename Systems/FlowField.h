@@ -0,0 +1,49 @@
+#pragma once
+#include "raylib.h"
+#include <vector>
+
+class LevelManager;
+
+// 🧭 FLOW FIELD (bidang XZ, nutup collision map -50..50)
+// 1x BFS dari cell player ke seluruh map, tiap cell nyimpen arah ke tetangga yang paling
+// deket ke player. Musuh tinggal baca arah di cell-nya: biaya per musuh konstan,
+// gak ada A* per musuh, dan gak nembus tembok.
+//
+// Rebuild cuma kalau player pindah cell atau collision map berubah (map ganti / tembok hancur).
+class FlowField {
+public:
+    explicit FlowField(float cellSize = 1.0f);
+
+    // Panggil tiap tick sebelum musuh update (murah kalau player masih di cell yang sama)
+    void Update(const LevelManager& level, Vector3 targetPos);
+
+    // Arah jalan (XZ, ternormalisasi) dari pos menuju target.
+    // false = pakai kejar lurus (gak ada map, di luar map, di dalam tembok, atau udah deket target)
+    bool SampleDirection(Vector3 pos, Vector3& outDir) const;
+
+    // Musuh yang kedorong masuk cell tembok: arah ke tetangga kosong (yang kejangkau) paling deket.
+    // false = cell-nya gak ketutup / gak ada tetangga kosong
+    bool SampleEscape(Vector3 pos, Vector3& outDir) const;
+
+    bool IsReady() const { return mReady; }
+    int GetRebuildCount() const { return mRebuildCount; }
+
+private:
+    int CellIndex(Vector3 pos) const; // -1 = di luar grid
+    void RebuildField(int targetCell);
+
+    float mCellSize;
+    int mCells;             // Grid mCells x mCells
+    int mStride;            // mCells + 2: grid dikasih bingkai tembok 1 cell, BFS gak perlu cek batas
+    bool mHasMap;
+    bool mReady;
+    int mMapVersion;        // LevelManager::GetCollisionVersion() terakhir
+    int mTargetCell;
+    int mRebuildCount;
+
+    std::vector<unsigned char> mMapCells;   // Hasil LevelManager::BuildBlockedGrid (tanpa bingkai)
+    std::vector<unsigned char> mBlocked;    // 1 = tembok / void / bingkai
+    std::vector<unsigned short> mDistance;  // Langkah BFS ke target (0xFFFF = gak kejangkau)
+    std::vector<unsigned char> mDirection;  // Index arah 0..7 (0xFF = gak ada)
+    std::vector<int> mQueue;                // Scratch BFS (biar gak alokasi tiap rebuild)
+};
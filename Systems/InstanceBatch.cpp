@@ -0,0 +1,36 @@
+#include "InstanceBatch.h"
+
+void InstanceBatch::Add(const Matrix& transform, Color color) {
+    Matrix m = transform;
+    m.m3 = color.r / 255.0f;
+    m.m7 = color.g / 255.0f;
+    m.m11 = color.b / 255.0f;
+    m.m15 = color.a / 255.0f;
+    mTransforms.push_back(m);
+}
+
+void InstanceBatch::AddData(Vector4 column0, Vector4 column1) {
+    Matrix m = { 0 };
+    m.m0 = column0.x; m.m1 = column0.y; m.m2 = column0.z; m.m3 = column0.w;
+    m.m4 = column1.x; m.m5 = column1.y; m.m6 = column1.z; m.m7 = column1.w;
+    mTransforms.push_back(m);
+}
+
+int InstanceBatch::Flush(const Mesh& mesh, const Material& material) {
+    int count = (int)mTransforms.size();
+    if (count == 0) return 0;
+
+    DrawMeshInstanced(mesh, material, mTransforms.data(), count);
+    mTransforms.clear(); // Kapasitas tetap, frame berikutnya gak alokasi lagi
+    return 1;
+}
+
+void SetupInstancedShader(Shader& shader) {
+    shader.locs[SHADER_LOC_MATRIX_MVP] = GetShaderLocation(shader, "mvp");
+#if defined(RAYLIB_VERSION_MAJOR) && (RAYLIB_VERSION_MAJOR > 5 || (RAYLIB_VERSION_MAJOR == 5 && RAYLIB_VERSION_MINOR >= 5))
+    shader.locs[SHADER_LOC_VERTEX_INSTANCE_TX] = GetShaderLocationAttrib(shader, "instanceTransform");
+#else
+    // raylib <= 5.0: DrawMeshInstanced numpang slot MATRIX_MODEL buat atribut instance
+    shader.locs[SHADER_LOC_MATRIX_MODEL] = GetShaderLocationAttrib(shader, "instanceTransform");
+#endif
+}
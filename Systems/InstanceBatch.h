@@ -0,0 +1,28 @@
+#pragma once
+#include "raylib.h"
+#include <vector>
+
+// 🧊 INSTANCE BATCH
+// Kumpulin transform + warna semua objek yang pakai mesh yang sama, lalu 1x DrawMeshInstanced.
+// Warna per-instance diselipin di baris bawah matrix (m3, m7, m11, m15) yang buat transform
+// affine selalu (0,0,0,1). VS_INSTANCED_CODE ambil warnanya dari situ & balikin matrix-nya,
+// jadi gak perlu VBO atribut tambahan di luar yang udah dikirim raylib.
+class InstanceBatch {
+public:
+    void Reserve(int count) { mTransforms.reserve(count); }
+    void Clear() { mTransforms.clear(); }
+    void Add(const Matrix& transform, Color color);
+    // Data mentah 2 vec4 per instance (kolom 0 & 1 instanceTransform), artinya diatur shader custom
+    void AddData(Vector4 column0, Vector4 column1);
+
+    // 1 draw call (0 kalau kosong), lalu batch dikosongin. Material wajib pakai shader instanced
+    int Flush(const Mesh& mesh, const Material& material);
+
+    int Count() const { return (int)mTransforms.size(); }
+
+private:
+    std::vector<Matrix> mTransforms;
+};
+
+// Sambungin atribut "instanceTransform" ke slot yang dibaca DrawMeshInstanced (beda antar versi raylib)
+void SetupInstancedShader(Shader& shader);
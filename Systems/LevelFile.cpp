@@ -0,0 +1,160 @@
+#include "LevelFile.h"
+#include "../Managers/LevelManager.h" // COLOR_WATER / COLOR_BREAKABLE
+#include <cstdio>
+#include <cstring>
+
+static bool SameRGB(Color a, Color b) {
+    return a.r == b.r && a.g == b.g && a.b == b.b;
+}
+
+LevelSourceStamp StampLevelSource(const char* imagePath) {
+    LevelSourceStamp stamp;
+    if (!FileExists(imagePath)) return stamp;
+    stamp.size = GetFileLength(imagePath);
+    stamp.modTime = GetFileModTime(imagePath);
+    return stamp;
+}
+
+void CompileLevelData(const Color* pixels, int width, int height, float worldSize, LevelData& out) {
+    out.width = width;
+    out.height = height;
+    out.worldSize = worldSize;
+    out.solid.Resize(width, height);
+    out.water.Resize(width, height);
+    out.breakable.Resize(width, height);
+    out.playerSpawns.clear();
+    out.enemySpawns.clear();
+
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            Color c = pixels[y * width + x];
+
+            // Pojok kiri atas pixel -> world (sama kayak scan spawn lama)
+            float u = (float)x / width;
+            float v = (float)y / height;
+            Vector3 world = { (u - 0.5f) * worldSize, 0.0f, (v - 0.5f) * worldSize };
+
+            // Logika: Warna Gelap = Tembok / Void (R,G,B < 80)
+            if (c.r < 80 && c.g < 80 && c.b < 80) out.solid.Set(x, y);
+            if (SameRGB(c, COLOR_WATER)) out.water.Set(x, y);
+            if (SameRGB(c, COLOR_BREAKABLE)) out.breakable.Set(x, y);
+
+            // Spawn: biru-ish = player (cuma yang pertama), merah-ish = musuh
+            if (out.playerSpawns.empty() && c.b > 200 && c.r < 100 && c.g < 150) out.playerSpawns.push_back(world);
+            if (c.r > 200 && c.g < 100 && c.b < 100) out.enemySpawns.push_back(world);
+        }
+    }
+
+    out.distances.Bake(out.solid, worldSize);
+}
+
+// --- WRITER ---
+
+static uint32_t AlignUp(uint32_t value) {
+    return (value + LEVEL_FILE_ALIGN - 1) & ~(LEVEL_FILE_ALIGN - 1);
+}
+
+// Reservasi tempat 1 block di belakang file (offset rata LEVEL_FILE_ALIGN)
+static LevelFileBlock PlaceBlock(uint32_t& cursor, uint32_t count, size_t elementSize) {
+    LevelFileBlock block;
+    block.offset = AlignUp(cursor);
+    block.count = count;
+    cursor = block.offset + (uint32_t)(count * elementSize);
+    return block;
+}
+
+bool WriteLevelFile(const char* path, const LevelData& data, const Color* pixels, const LevelSourceStamp& source) {
+    LevelFileHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic = LEVEL_FILE_MAGIC;
+    header.version = LEVEL_FILE_VERSION;
+    header.width = data.width;
+    header.height = data.height;
+    header.worldSize = data.worldSize;
+    header.sourceSize = source.size;
+    header.sourceModTime = source.modTime;
+
+    uint32_t cursor = sizeof(LevelFileHeader);
+    uint32_t pixelCount = (uint32_t)(data.width * data.height);
+    header.solidBits = PlaceBlock(cursor, data.solid.WordCount(), sizeof(uint64_t));
+    header.waterBits = PlaceBlock(cursor, data.water.WordCount(), sizeof(uint64_t));
+    header.breakableBits = PlaceBlock(cursor, data.breakable.WordCount(), sizeof(uint64_t));
+    header.distances = PlaceBlock(cursor, pixelCount, sizeof(float));
+    header.pixels = PlaceBlock(cursor, pixelCount, sizeof(Color));
+    header.playerSpawns = PlaceBlock(cursor, (uint32_t)data.playerSpawns.size(), sizeof(Vector3));
+    header.enemySpawns = PlaceBlock(cursor, (uint32_t)data.enemySpawns.size(), sizeof(Vector3));
+    header.fileSize = AlignUp(cursor);
+
+    // Rakit di memori dulu (padding otomatis 0), baru tulis sekali
+    std::vector<unsigned char> bytes(header.fileSize, 0);
+    auto put = [&bytes](const LevelFileBlock& block, const void* src, size_t elementSize) {
+        if (block.count > 0) memcpy(&bytes[block.offset], src, block.count * elementSize);
+    };
+    memcpy(bytes.data(), &header, sizeof(header));
+    put(header.solidBits, data.solid.Words(), sizeof(uint64_t));
+    put(header.waterBits, data.water.Words(), sizeof(uint64_t));
+    put(header.breakableBits, data.breakable.Words(), sizeof(uint64_t));
+    put(header.distances, data.distances.Data(), sizeof(float));
+    put(header.pixels, pixels, sizeof(Color));
+    put(header.playerSpawns, data.playerSpawns.data(), sizeof(Vector3));
+    put(header.enemySpawns, data.enemySpawns.data(), sizeof(Vector3));
+
+    FILE* file = fopen(path, "wb");
+    if (file == nullptr) return false;
+    bool ok = fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size();
+    ok = (fclose(file) == 0) && ok;
+    return ok;
+}
+
+// --- VIEW (mmap) ---
+
+bool LevelFileView::Open(const char* path) {
+    Close();
+    if (!mFile.Open(path)) return false;
+
+    if (mFile.Size() < sizeof(LevelFileHeader)) {
+        Close();
+        return false;
+    }
+    const LevelFileHeader* header = (const LevelFileHeader*)mFile.Data();
+    mHeader = header;
+
+    // Ukuran dicek dulu, baru dikali (64-bit): file rusak / iseng gak bisa bikin overflow
+    bool valid = header->magic == LEVEL_FILE_MAGIC
+        && header->version == LEVEL_FILE_VERSION
+        && header->width > 0 && header->width <= LEVEL_FILE_MAX_SIDE
+        && header->height > 0 && header->height <= LEVEL_FILE_MAX_SIDE
+        && header->worldSize > 0.0f
+        && header->fileSize == mFile.Size();
+    if (!valid) {
+        Close();
+        return false;
+    }
+
+    uint64_t wordCount = (((uint64_t)header->width + 63) >> 6) * (uint64_t)header->height;
+    uint64_t pixelCount = (uint64_t)header->width * (uint64_t)header->height;
+    valid = ValidateBlock(header->solidBits, sizeof(uint64_t), wordCount)
+        && ValidateBlock(header->waterBits, sizeof(uint64_t), wordCount)
+        && ValidateBlock(header->breakableBits, sizeof(uint64_t), wordCount)
+        && ValidateBlock(header->distances, sizeof(float), pixelCount)
+        && ValidateBlock(header->pixels, sizeof(Color), pixelCount)
+        && ValidateBlock(header->playerSpawns, sizeof(Vector3), header->playerSpawns.count)
+        && ValidateBlock(header->enemySpawns, sizeof(Vector3), header->enemySpawns.count);
+
+    if (!valid) {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+void LevelFileView::Close() {
+    mFile.Close();
+    mHeader = nullptr;
+}
+
+bool LevelFileView::ValidateBlock(const LevelFileBlock& block, size_t elementSize, uint64_t expectedCount) const {
+    if (block.count != expectedCount) return false;
+    if (block.offset % LEVEL_FILE_ALIGN != 0) return false;
+    return (size_t)block.offset + (size_t)block.count * elementSize <= mFile.Size();
+}
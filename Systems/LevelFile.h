@@ -0,0 +1,89 @@
+#pragma once
+#include "raylib.h"
+#include <cstdint>
+#include <vector>
+#include "BitGrid.h"
+#include "DistanceField.h"
+#include "MappedFile.h"
+
+// 🗺️ LEVEL FILE (.mblv) - collision map yang udah di-compile offline (Tools/LevelCompiler)
+// Isinya langsung dalam bentuk yang dipakai runtime, jadi game cukup mmap + cek header:
+// gak ada decode PNG, gak ada scan pixel, gak ada bake SDF pas ganti menu.
+//
+// Layout: [LevelFileHeader][block...]. Tiap block rata 64 byte dari awal file, little-endian.
+// Header nyimpen ukuran + mtime PNG sumbernya: PNG diedit tapi lupa compile ulang = file basi,
+// LevelManager balik compile PNG-nya sendiri.
+constexpr uint32_t LEVEL_FILE_MAGIC = 0x564C424D; // "MBLV"
+constexpr uint32_t LEVEL_FILE_VERSION = 2;
+constexpr uint32_t LEVEL_FILE_ALIGN = 64;
+constexpr int32_t LEVEL_FILE_MAX_SIDE = 8192; // Batas width / height (dicek sebelum ngalik apa pun)
+
+struct LevelFileBlock {
+    uint32_t offset; // Byte dari awal file
+    uint32_t count;  // Jumlah elemen (bukan byte)
+};
+
+// Sidik PNG sumber (ukuran byte + waktu modif dari raylib)
+struct LevelSourceStamp {
+    int64_t size = 0;
+    int64_t modTime = 0;
+
+    bool operator==(const LevelSourceStamp& other) const { return size == other.size && modTime == other.modTime; }
+};
+LevelSourceStamp StampLevelSource(const char* imagePath); // File gak ada = {0, 0}
+
+struct LevelFileHeader {
+    uint32_t magic;
+    uint32_t version;
+    int32_t width;        // Pixel collision map
+    int32_t height;
+    float worldSize;      // Sisi map di world (COLLISION_WORLD_SIZE pas compile)
+    uint32_t fileSize;    // Buat deteksi file kepotong
+    int64_t sourceSize;   // LevelSourceStamp PNG pas compile
+    int64_t sourceModTime;
+    LevelFileBlock solidBits;     // uint64_t, BitGrid layer solid
+    LevelFileBlock waterBits;     // uint64_t
+    LevelFileBlock breakableBits; // uint64_t
+    LevelFileBlock distances;     // float, DistanceField (world unit)
+    LevelFileBlock pixels;        // Color RGBA, buat texture visual map
+    LevelFileBlock playerSpawns;  // Vector3 (pixel biru pertama, 0 atau 1)
+    LevelFileBlock enemySpawns;   // Vector3 (pixel merah)
+};
+
+// Hasil compile collision map di memori (dipakai tool offline & fallback PNG)
+struct LevelData {
+    int width = 0;
+    int height = 0;
+    float worldSize = 0.0f;
+    BitGrid solid;
+    BitGrid water;
+    BitGrid breakable;
+    DistanceField distances;
+    std::vector<Vector3> playerSpawns;
+    std::vector<Vector3> enemySpawns;
+};
+
+// Pixel collision map -> semua layer + SDF + daftar spawn (aturan warna sama kayak LevelManager dulu)
+void CompileLevelData(const Color* pixels, int width, int height, float worldSize, LevelData& out);
+bool WriteLevelFile(const char* path, const LevelData& data, const Color* pixels, const LevelSourceStamp& source);
+
+// File .mblv yang di-mmap. Semua pointer valid sampai Close() / Open() lagi
+class LevelFileView {
+public:
+    LevelFileView() : mHeader(nullptr) {}
+
+    bool Open(const char* path); // false = gak ada / header atau ukuran block gak valid
+    void Close();
+    bool IsOpen() const { return mHeader != nullptr; }
+
+    const LevelFileHeader& Header() const { return *mHeader; }
+    LevelSourceStamp Source() const { LevelSourceStamp s; s.size = mHeader->sourceSize; s.modTime = mHeader->sourceModTime; return s; }
+    template <typename T>
+    const T* Block(const LevelFileBlock& block) const { return (const T*)(mFile.Data() + block.offset); }
+
+private:
+    bool ValidateBlock(const LevelFileBlock& block, size_t elementSize, uint64_t expectedCount) const;
+
+    MappedFile mFile;
+    const LevelFileHeader* mHeader;
+};
@@ -0,0 +1,144 @@
+#include "Lz4.h"
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Aturan format LZ4: 5 byte terakhir selalu literal, match terakhir mulai >= 12 byte sebelum akhir
+static const int LZ4_MIN_MATCH = 4;
+static const int LZ4_LAST_LITERALS = 5;
+static const int LZ4_MF_LIMIT = 12;
+static const int LZ4_MAX_OFFSET = 65535;
+static const int LZ4_HASH_BITS = 12;
+
+static uint32_t Read32(const unsigned char* p) {
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static uint32_t Hash4(uint32_t v) {
+    return (v * 2654435761u) >> (32 - LZ4_HASH_BITS);
+}
+
+// Panjang >= 15 disambung byte 255, 255, ..., sisa
+static bool WriteLength(unsigned char*& op, const unsigned char* end, int length) {
+    while (length >= 255) {
+        if (op >= end) return false;
+        *op++ = 255;
+        length -= 255;
+    }
+    if (op >= end) return false;
+    *op++ = (unsigned char)length;
+    return true;
+}
+
+// 1 sequence = token + literal + (offset + panjang match, kecuali sequence terakhir)
+static bool EmitSequence(unsigned char*& op, const unsigned char* end,
+                         const unsigned char* literals, int literalLength, int offset, int matchLength) {
+    if (op >= end) return false;
+    unsigned char* token = op++;
+    int matchCode = matchLength - LZ4_MIN_MATCH;
+
+    *token = (unsigned char)((literalLength >= 15 ? 15 : literalLength) << 4);
+    if (literalLength >= 15 && !WriteLength(op, end, literalLength - 15)) return false;
+    if (end - op < literalLength) return false;
+    if (literalLength > 0) memcpy(op, literals, literalLength);
+    op += literalLength;
+
+    if (matchLength == 0) return true; // Sequence terakhir: literal doang
+
+    if (end - op < 2) return false;
+    *op++ = (unsigned char)(offset & 0xFF);
+    *op++ = (unsigned char)(offset >> 8);
+    *token |= (unsigned char)(matchCode >= 15 ? 15 : matchCode);
+    if (matchCode >= 15 && !WriteLength(op, end, matchCode - 15)) return false;
+    return true;
+}
+
+int Lz4CompressBound(int srcSize) {
+    return srcSize + srcSize / 255 + 16;
+}
+
+int Lz4Compress(const unsigned char* src, int srcSize, unsigned char* dst, int dstCapacity) {
+    unsigned char* op = dst;
+    const unsigned char* end = dst + dstCapacity;
+    int anchor = 0;
+
+    if (srcSize >= LZ4_MF_LIMIT + 1) {
+        std::vector<int> table((size_t)1 << LZ4_HASH_BITS, -1);
+        int matchLimit = srcSize - LZ4_MF_LIMIT;
+        int matchEnd = srcSize - LZ4_LAST_LITERALS;
+        int ip = 0;
+
+        while (ip < matchLimit) {
+            uint32_t sequence = Read32(src + ip);
+            uint32_t h = Hash4(sequence);
+            int ref = table[h];
+            table[h] = ip;
+
+            if (ref < 0 || ip - ref > LZ4_MAX_OFFSET || Read32(src + ref) != sequence) {
+                ip++;
+                continue;
+            }
+
+            int length = LZ4_MIN_MATCH;
+            while (ip + length < matchEnd && src[ref + length] == src[ip + length]) length++;
+
+            if (!EmitSequence(op, end, src + anchor, ip - anchor, ip - ref, length)) return 0;
+            ip += length;
+            anchor = ip;
+        }
+    }
+
+    if (!EmitSequence(op, end, src + anchor, srcSize - anchor, 0, 0)) return 0;
+    return (int)(op - dst);
+}
+
+int Lz4Decompress(const unsigned char* src, int srcSize, unsigned char* dst, int dstCapacity) {
+    int ip = 0;
+    int op = 0;
+
+    while (ip < srcSize) {
+        int token = src[ip++];
+
+        // A. Literal
+        int literalLength = token >> 4;
+        if (literalLength == 15) {
+            int b;
+            do {
+                if (ip >= srcSize) return -1;
+                b = src[ip++];
+                literalLength += b;
+            } while (b == 255);
+        }
+        if (literalLength > srcSize - ip || literalLength > dstCapacity - op) return -1;
+        memcpy(dst + op, src + ip, literalLength);
+        ip += literalLength;
+        op += literalLength;
+
+        if (ip >= srcSize) break; // Sequence terakhir gak punya match
+
+        // B. Match (boleh overlap sama output-nya sendiri -> copy per byte)
+        if (srcSize - ip < 2) return -1;
+        int offset = src[ip] | (src[ip + 1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > op) return -1;
+
+        int matchLength = token & 15;
+        if (matchLength == 15) {
+            int b;
+            do {
+                if (ip >= srcSize) return -1;
+                b = src[ip++];
+                matchLength += b;
+            } while (b == 255);
+        }
+        matchLength += LZ4_MIN_MATCH;
+        if (matchLength > dstCapacity - op) return -1;
+
+        const unsigned char* match = dst + op - offset;
+        for (int i = 0; i < matchLength; i++) dst[op + i] = match[i];
+        op += matchLength;
+    }
+    return op;
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+// 🗜️ LZ4 (format block standar, tanpa frame header) - dipakai AssetPack buat blob yang masih bisa dikecilin
+// Compressor greedy 1 hash table (cepet, rasio biasa aja). Decompressor cek semua batas,
+// jadi data rusak / kepotong = gagal, bukan baca di luar buffer.
+
+// Ukuran buffer output terburuk buat srcSize byte (data yang gak bisa dikompres)
+int Lz4CompressBound(int srcSize);
+
+// Return jumlah byte output, 0 = dstCapacity kurang
+int Lz4Compress(const unsigned char* src, int srcSize, unsigned char* dst, int dstCapacity);
+
+// Return jumlah byte hasil (harus == ukuran asli), -1 = data rusak / dst kurang
+int Lz4Decompress(const unsigned char* src, int srcSize, unsigned char* dst, int dstCapacity);
@@ -0,0 +1,99 @@
+#include "MappedFile.h"
+
+// Sengaja gak include raylib.h di sini: windows.h bentrok nama sama raylib (CloseWindow, Rectangle, ...)
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile() : mData(nullptr), mSize(0) {
+#if defined(_WIN32)
+    mFileHandle = nullptr;
+    mMappingHandle = nullptr;
+#endif
+}
+
+MappedFile::~MappedFile() {
+    Close();
+}
+
+#if defined(_WIN32)
+
+bool MappedFile::Open(const char* path) {
+    Close();
+
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr) {
+        CloseHandle(file);
+        return false;
+    }
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    mFileHandle = file;
+    mMappingHandle = mapping;
+    mData = (const unsigned char*)view;
+    mSize = (size_t)size.QuadPart;
+    return true;
+}
+
+void MappedFile::Close() {
+    if (mData != nullptr) UnmapViewOfFile(mData);
+    if (mMappingHandle != nullptr) CloseHandle((HANDLE)mMappingHandle);
+    if (mFileHandle != nullptr) CloseHandle((HANDLE)mFileHandle);
+    mData = nullptr;
+    mSize = 0;
+    mFileHandle = nullptr;
+    mMappingHandle = nullptr;
+}
+
+#else
+
+bool MappedFile::Open(const char* path) {
+    Close();
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return false;
+    }
+
+    void* view = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // Mapping tetap hidup walau fd ditutup
+    if (view == MAP_FAILED) return false;
+
+    mData = (const unsigned char*)view;
+    mSize = (size_t)st.st_size;
+    return true;
+}
+
+void MappedFile::Close() {
+    if (mData != nullptr) munmap((void*)mData, mSize);
+    mData = nullptr;
+    mSize = 0;
+}
+
+#endif
@@ -0,0 +1,28 @@
+#pragma once
+#include <cstddef>
+
+// 📄 MAPPED FILE (read-only)
+// File dipetakan langsung ke memori (mmap / MapViewOfFile): gak ada read / copy / parse,
+// halaman yang beneran disentuh aja yang dibaca OS. Pointer Data() valid sampai Close().
+class MappedFile {
+public:
+    MappedFile();
+    ~MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool Open(const char* path);
+    void Close();
+
+    bool IsOpen() const { return mData != nullptr; }
+    const unsigned char* Data() const { return mData; }
+    size_t Size() const { return mSize; }
+
+private:
+    const unsigned char* mData;
+    size_t mSize;
+#if defined(_WIN32)
+    void* mFileHandle;
+    void* mMappingHandle;
+#endif
+};
@@ -1,6 +1,6 @@
 #include "ProjectileManager.h"
 #include "../Player/Player.h" // Butuh ini buat tau PlayerStats & ProjectileType
-#include "../Managers/AssetManager.h"
+#include "../Managers/SoundVoicePool.h"
 #include "../Managers/ParticleSystem.h"
 #include "../Utils/MathUtils.h" 
 #include <algorithm>
@@ -15,6 +15,7 @@ void ProjectileManager::SpawnProjectile(Vector3 pos, Vector3 dir, const PlayerSt
     // 1. Posisi & Arah
     p.position = pos;
     p.position.y = 0.5f; // Muncul agak tinggi dikit dari lantai (pinggang player)
+    p.prevPosition = p.position;
     p.direction = dir;
     
     // 2. Stats dari Player (Senjata)
@@ -43,7 +44,7 @@ void ProjectileManager::SpawnProjectile(Vector3 pos, Vector3 dir, const PlayerSt
     mProjectiles.push_back(p);
 }
 
-void ProjectileManager::Update(float dt, AssetManager& assets, ParticleSystem& particles) {
+void ProjectileManager::Update(float dt, SoundVoicePool& sfx, ParticleSystem& particles) {
     for (auto& p : mProjectiles) {
         if (!p.active) continue;
 
@@ -63,21 +64,19 @@ void ProjectileManager::Update(float dt, AssetManager& assets, ParticleSystem& p
 
             // A. Kalau Bazooka (Explosive), ledakannya GEDE
             if (p.type == ProjectileType::EXPLOSIVE) {
-                particles.SpawnExplosion(p.position, ORANGE, 50); // Partikel banyak
+                particles.SpawnExplosion(ParticleEffect::BAZOOKA, p.position, ORANGE, 50); // Partikel banyak
                 
                 // Sound Ledakan (Kalau ada asetnya)
-                // Sound& boom = assets.GetSound("explosion");
-                // PlaySound(boom);
+                // sfx.Play(SoundEffect::EXPLOSION);
                 
                 // Note: Logic damage area musuh nanti di Game.cpp
             } 
             // B. Kalau Peluru Biasa (Telor Pecah)
             else {
-                particles.SpawnExplosion(p.position, YELLOW, 5);
+                particles.SpawnExplosion(ParticleEffect::BULLET_IMPACT, p.position, YELLOW, 5);
                 
-                Sound& sfx = assets.GetSound("crack");
-                SetSoundPitch(sfx, GetRandomFloat(1.8f, 2.2f)); 
-                PlaySound(sfx);
+                // Pitch acak + batas voice diurus pool (headless: cuma dihitung)
+                sfx.Play(SoundEffect::BULLET_IMPACT);
             }
         }
 
@@ -94,7 +93,11 @@ void ProjectileManager::Update(float dt, AssetManager& assets, ParticleSystem& p
     mProjectiles.erase(iterator, mProjectiles.end());
 }
 
-void ProjectileManager::Draw() {
+void ProjectileManager::SavePreviousState() {
+    for (auto& p : mProjectiles) p.prevPosition = p.position;
+}
+
+void ProjectileManager::Draw(float alpha) {
     for (const auto& p : mProjectiles) {
         if (!p.active) continue;
         
@@ -107,7 +110,7 @@ void ProjectileManager::Draw() {
             pColor = { 255, 230, 180, 255 }; // Telur normal
         }
 
-        DrawSphere(p.position, p.radius, pColor);
+        DrawSphere(Vector3Lerp(p.prevPosition, p.position, alpha), p.radius, pColor);
     }
 }
 
@@ -5,7 +5,7 @@
 
 // Forward declarations
 // Kita cuma butuh nama kelasnya biar gak error, gak perlu include file-nya
-class AssetManager;
+class SoundVoicePool;
 class ParticleSystem;
 struct PlayerStats; 
 
@@ -18,6 +18,7 @@ enum class ProjectileType {
 
 struct Projectile {
     Vector3 position;
+    Vector3 prevPosition; // Posisi tick sebelumnya (interpolasi render)
     Vector3 direction;
     float speed;
     float damage;
@@ -44,13 +45,16 @@ public:
     // Spawn butuh data stats dari player
     void SpawnProjectile(Vector3 pos, Vector3 dir, const PlayerStats& stats);
 
-    // Update cuma butuh Assets (Suara) & Particles (Debu Tanah)
+    // Update cuma butuh SFX (Voice Pool) & Particles (Debu Tanah)
     // Musuh dihapus dari sini karena logic tabrakan pindah ke Game.cpp
-    void Update(float dt, AssetManager& assets, ParticleSystem& particles);
+    void Update(float dt, SoundVoicePool& sfx, ParticleSystem& particles);
 
-    void Draw();
+    void Draw(float alpha = 1.0f);
     void Reset();
 
+    // Fixed timestep: snapshot posisi sebelum tick baru
+    void SavePreviousState();
+
     // Getter buat dipake di Game.cpp (Collision detection)
     std::vector<Projectile>& GetProjectiles() { return mProjectiles; }
 
@@ -0,0 +1,47 @@
+#include "ShadowBatch.h"
+#include "rlgl.h"
+
+// Quad per rlBegin/rlEnd dibatasi biar gak lewat kapasitas buffer batch rlgl
+static const int SHADOW_QUADS_PER_CHUNK = 1024;
+
+void ShadowBatch::Add(Vector3 position, float size, Color tint) {
+    mShadows.push_back({ position, size * 0.5f, tint });
+}
+
+void ShadowBatch::Draw(Texture2D texture) {
+    int count = (int)mShadows.size();
+    if (count == 0) return;
+
+    rlDisableDepthMask();
+    rlSetTexture(texture.id);
+
+    for (int start = 0; start < count; start += SHADOW_QUADS_PER_CHUNK) {
+        int end = start + SHADOW_QUADS_PER_CHUNK;
+        if (end > count) end = count;
+        rlCheckRenderBatchLimit((end - start) * 4);
+
+        rlBegin(RL_QUADS);
+        for (int i = start; i < end; i++) {
+            const Shadow& s = mShadows[i];
+            float x0 = s.position.x - s.halfSize, x1 = s.position.x + s.halfSize;
+            float z0 = s.position.z - s.halfSize, z1 = s.position.z + s.halfSize;
+            float y = s.position.y;
+
+            // Urutan CCW dilihat dari atas (normal +Y), sama kayak DrawPlane
+            rlColor4ub(s.tint.r, s.tint.g, s.tint.b, s.tint.a);
+            rlNormal3f(0.0f, 1.0f, 0.0f);
+            rlTexCoord2f(0.0f, 0.0f); rlVertex3f(x0, y, z0);
+            rlTexCoord2f(0.0f, 1.0f); rlVertex3f(x0, y, z1);
+            rlTexCoord2f(1.0f, 1.0f); rlVertex3f(x1, y, z1);
+            rlTexCoord2f(1.0f, 0.0f); rlVertex3f(x1, y, z0);
+        }
+        rlEnd();
+    }
+
+    rlSetTexture(0);
+    // Flush sekarang selagi depth mask masih off (rlgl nunda draw sampai batch di-flush)
+    rlDrawRenderBatchActive();
+    rlEnableDepthMask();
+
+    mShadows.clear();
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include "raylib.h"
+#include <vector>
+
+// 🌑 SHADOW BATCH (blob shadow semua entity)
+// Tiap caster cuma nyumbang (posisi, ukuran, warna). Draw() gambar semuanya jadi
+// 1 stream quad rlgl pakai mShadowTexture: 1x set texture, 1x depth mask off, 1 draw call
+// (dulu tiap musuh DrawModelEx shadow_plane + toggle depth mask sendiri-sendiri).
+class ShadowBatch {
+public:
+    void Reserve(int count) { mShadows.reserve(count); }
+
+    // position.y = tinggi quad di atas tanah, size = panjang sisi (world unit)
+    void Add(Vector3 position, float size, Color tint);
+
+    // Gambar semua shadow lalu kosongin batch
+    void Draw(Texture2D texture);
+
+    int Count() const { return (int)mShadows.size(); }
+
+private:
+    struct Shadow {
+        Vector3 position;
+        float halfSize;
+        Color tint;
+    };
+    std::vector<Shadow> mShadows;
+};
@@ -0,0 +1,114 @@
+#include "SpatialHashGrid.h"
+#include <algorithm>
+#include <cmath>
+
+SpatialHashGrid::SpatialHashGrid(float cellSize, int bucketCount)
+    : mCellSize(cellSize), mInvCellSize(1.0f / cellSize)
+{
+    // Bulatkan ke power of 2 biar hash cukup pakai mask
+    int buckets = 1;
+    while (buckets < bucketCount) buckets <<= 1;
+    mBucketMask = buckets - 1;
+
+    mBucketStart.assign(buckets + 1, 0);
+}
+
+void SpatialHashGrid::Clear() {
+    mPending.clear();
+    mSortedIds.clear();
+    std::fill(mBucketStart.begin(), mBucketStart.end(), 0); // Grid kosong tetap valid buat Query
+}
+
+int SpatialHashGrid::CellCoord(float v) const {
+    return (int)floorf(v * mInvCellSize);
+}
+
+int SpatialHashGrid::HashCell(int cx, int cz) const {
+    // Hash 2 bilangan prima besar (Teschner et al.)
+    unsigned int h = ((unsigned int)cx * 73856093u) ^ ((unsigned int)cz * 19349663u);
+    return (int)(h & (unsigned int)mBucketMask);
+}
+
+void SpatialHashGrid::Insert(int id, Vector3 position, float radius) {
+    int minX = CellCoord(position.x - radius);
+    int maxX = CellCoord(position.x + radius);
+    int minZ = CellCoord(position.z - radius);
+    int maxZ = CellCoord(position.z + radius);
+
+    for (int cz = minZ; cz <= maxZ; cz++) {
+        for (int cx = minX; cx <= maxX; cx++) {
+            mPending.push_back({HashCell(cx, cz), id});
+        }
+    }
+}
+
+void SpatialHashGrid::Build() {
+    // Counting sort per bucket (tanpa alokasi per cell)
+    std::fill(mBucketStart.begin(), mBucketStart.end(), 0);
+    for (const auto& p : mPending) mBucketStart[p.bucket + 1]++;
+    for (size_t i = 1; i < mBucketStart.size(); i++) mBucketStart[i] += mBucketStart[i - 1];
+
+    mSortedIds.resize(mPending.size());
+    mBucketCursor.assign(mBucketStart.begin(), mBucketStart.end() - 1);
+    for (const auto& p : mPending) {
+        mSortedIds[mBucketCursor[p.bucket]++] = p.id;
+    }
+}
+
+void SpatialHashGrid::Query(Vector3 center, float radius, std::vector<int>& outIds) const {
+    outIds.clear();
+
+    int minX = CellCoord(center.x - radius);
+    int maxX = CellCoord(center.x + radius);
+    int minZ = CellCoord(center.z - radius);
+    int maxZ = CellCoord(center.z + radius);
+
+    for (int cz = minZ; cz <= maxZ; cz++) {
+        for (int cx = minX; cx <= maxX; cx++) {
+            int bucket = HashCell(cx, cz);
+            for (int i = mBucketStart[bucket]; i < mBucketStart[bucket + 1]; i++) {
+                outIds.push_back(mSortedIds[i]);
+            }
+        }
+    }
+
+    // Entity besar ada di banyak cell + bucket bisa tabrakan hash -> dedupe.
+    // Sort juga bikin urutan cek = urutan index (sama kayak brute force)
+    std::sort(outIds.begin(), outIds.end());
+    outIds.erase(std::unique(outIds.begin(), outIds.end()), outIds.end());
+}
+
+void SpatialHashGrid::QueryPoints(Vector3 center, float radius, std::vector<int>& outIds) const {
+    int minX = CellCoord(center.x - radius);
+    int maxX = CellCoord(center.x + radius);
+    int minZ = CellCoord(center.z - radius);
+    int maxZ = CellCoord(center.z + radius);
+
+    // Area kegedean buat buffer bucket di stack -> jalur biasa aja
+    const int MAX_BUCKETS = 64;
+    if ((maxX - minX + 1) * (maxZ - minZ + 1) > MAX_BUCKETS) {
+        Query(center, radius, outIds);
+        return;
+    }
+
+    // 2 cell beda bisa jatuh ke bucket sama (tabrakan hash) -> bucket jangan dibaca 2x
+    int buckets[MAX_BUCKETS];
+    int bucketCount = 0;
+    for (int cz = minZ; cz <= maxZ; cz++) {
+        for (int cx = minX; cx <= maxX; cx++) {
+            int bucket = HashCell(cx, cz);
+            bool seen = false;
+            for (int k = 0; k < bucketCount; k++) {
+                if (buckets[k] == bucket) { seen = true; break; }
+            }
+            if (!seen) buckets[bucketCount++] = bucket;
+        }
+    }
+
+    outIds.clear();
+    for (int k = 0; k < bucketCount; k++) {
+        for (int i = mBucketStart[buckets[k]]; i < mBucketStart[buckets[k] + 1]; i++) {
+            outIds.push_back(mSortedIds[i]);
+        }
+    }
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include "raylib.h"
+#include <vector>
+
+// 🗺️ SPATIAL HASH GRID (bidang XZ)
+// Dibangun ulang tiap tick dari posisi + radius entity.
+// Entity dimasukin ke SEMUA cell yang ketutup lingkarannya (boss radius 5 = banyak cell),
+// jadi query cukup ngecek cell di sekitar area query aja.
+//
+// Hasil Query() = daftar ID unik, URUT NAIK. Urutan ini sengaja sama kayak
+// loop brute force (index vector), jadi "hit pertama" tetap identik.
+// Filter di sini konservatif (cuma cell), cek tabrakan asli tetap di pemanggil.
+class SpatialHashGrid {
+public:
+    explicit SpatialHashGrid(float cellSize = 4.0f, int bucketCount = 1024);
+
+    void Clear();
+    void Insert(int id, Vector3 position, float radius);
+    void Build(); // Wajib dipanggil setelah semua Insert, sebelum Query
+
+    // Ambil kandidat yang cell-nya overlap lingkaran (center, radius) di XZ
+    void Query(Vector3 center, float radius, std::vector<int>& outIds) const;
+
+    // Versi cepat khusus grid yang diisi titik (Insert radius 0): tiap ID cuma ada di 1 bucket,
+    // jadi cukup bucket-nya yang di-dedupe, gak perlu sort ID. Hasil TIDAK urut index.
+    void QueryPoints(Vector3 center, float radius, std::vector<int>& outIds) const;
+
+    int GetEntryCount() const { return (int)mSortedIds.size(); }
+    float GetCellSize() const { return mCellSize; }
+
+private:
+    struct PendingEntry {
+        int bucket;
+        int id;
+    };
+
+    int CellCoord(float v) const;
+    int HashCell(int cx, int cz) const;
+
+    float mCellSize;
+    float mInvCellSize;
+    int mBucketMask; // bucketCount harus power of 2
+
+    std::vector<PendingEntry> mPending;  // Hasil Insert (belum disortir)
+    std::vector<int> mBucketStart;       // Prefix sum, size = bucketCount + 1
+    std::vector<int> mSortedIds;         // ID dikelompokkan per bucket
+    std::vector<int> mBucketCursor;      // Scratch buat Build (biar gak alokasi tiap tick)
+};
@@ -0,0 +1,73 @@
+// 📦 ASSET PACKER (offline): semua aset di daftar AssetManager -> 1 file .mbpk yang tinggal di-mmap game
+// Build: make tools  ->  ./Tools/AssetPacker [output.mbpk]   (jalanin dari folder game, default Resources/assets.mbpk)
+// File lepas yang gak ada di-skip (game fallback sendiri). Mesh procedural di-bake lewat window
+// tersembunyi (GenMesh* butuh context GL); gagal buka window = mesh di-skip, game tetap GenMesh* sendiri.
+// Aset yang diganti setelah di-pack otomatis dibaca dari file lepas (ukuran / mtime beda), tetap pack ulang sebelum rilis.
+
+#include "raylib.h"
+#include "Managers/AssetManager.h"
+#include "Systems/AssetPack.h"
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+int main(int argc, char** argv) {
+    const char* outputPath = (argc >= 2) ? argv[1] : ASSET_PACK_PATH;
+    SetTraceLogLevel(LOG_WARNING);
+
+    auto t0 = std::chrono::steady_clock::now();
+    std::vector<AssetJob> jobs;
+    AssetManager::BuildJobList(jobs);
+
+    // Window 1x1 tersembunyi cuma buat GenMesh* (upload GPU-nya dibuang lagi)
+    bool needsMeshes = false;
+    for (const auto& job : jobs) needsMeshes = needsMeshes || job.type == AssetJobType::MODEL_PROCEDURAL;
+    if (needsMeshes) {
+        SetConfigFlags(FLAG_WINDOW_HIDDEN);
+        InitWindow(1, 1, "AssetPacker");
+    }
+
+    AssetPackWriter writer;
+    int skipped = 0;
+    for (const auto& job : jobs) {
+        if (job.type == AssetJobType::SOUND_PROCEDURAL) continue; // Disintesis runtime, gak ada file
+
+        if (job.type == AssetJobType::MODEL_PROCEDURAL) {
+            if (!IsWindowReady()) {
+                printf("⚠️ %s: skip (gak ada context GL)\n", job.path.c_str());
+                skipped++;
+                continue;
+            }
+            Mesh mesh = job.makeMesh();
+            writer.AddMesh(job.path, mesh);
+            printf("🧊 %s | %d vertex | %d segitiga\n", job.path.c_str(), mesh.vertexCount, mesh.triangleCount);
+            UnloadMesh(mesh);
+            continue;
+        }
+
+        int size = 0;
+        unsigned char* data = LoadFileData(job.path.c_str(), &size);
+        if (data == nullptr) {
+            printf("⚠️ %s: skip (file gak ada)\n", job.path.c_str());
+            skipped++;
+            continue;
+        }
+        writer.AddFile(job.path, data, size, GetFileModTime(job.path.c_str()));
+        printf("📄 %s | %d byte\n", job.path.c_str(), size);
+        UnloadFileData(data);
+    }
+
+    if (IsWindowReady()) CloseWindow();
+
+    if (!writer.Write(outputPath)) {
+        printf("❌ gagal nulis %s\n", outputPath);
+        return 1;
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    printf("✅ %s | %d entry (%d skip) | %zu -> %zu byte | %.1f ms\n",
+           outputPath, writer.Count(), skipped, writer.RawBytes(), writer.StoredBytes(),
+           std::chrono::duration<double, std::milli>(t1 - t0).count());
+    return 0;
+}
@@ -0,0 +1,59 @@
+// 🗺️ LEVEL COMPILER (offline): collision map PNG -> file .mblv yang tinggal di-mmap game
+// Build: make tools  ->  ./Tools/LevelCompiler ground.png [lainnya.png ...]
+// Output ditaruh di sebelah PNG-nya ("ground.png" -> "ground.mblv"), LevelManager otomatis
+// milih .mblv kalau ada. Ukuran + mtime PNG ikut dicatat, jadi .mblv basi otomatis dilewatin
+// (game balik decode PNG) sampai di-compile ulang.
+
+#include "raylib.h"
+#include "Managers/LevelManager.h" // COLLISION_WORLD_SIZE
+#include "Systems/LevelFile.h"
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        printf("Usage: %s <collision_map.png> [...]\n", argv[0]);
+        return 1;
+    }
+    SetTraceLogLevel(LOG_WARNING);
+
+    int failures = 0;
+    for (int i = 1; i < argc; i++) {
+        std::string imagePath = argv[i];
+        std::string levelPath = imagePath;
+        size_t dot = levelPath.find_last_of('.');
+        if (dot != std::string::npos) levelPath.erase(dot);
+        levelPath += ".mblv";
+
+        auto t0 = std::chrono::steady_clock::now();
+        Image image = LoadImage(imagePath.c_str());
+        if (image.data == nullptr) {
+            printf("❌ %s: gagal load\n", imagePath.c_str());
+            failures++;
+            continue;
+        }
+        Color* pixels = LoadImageColors(image);
+
+        LevelData data;
+        CompileLevelData(pixels, image.width, image.height, COLLISION_WORLD_SIZE, data);
+        bool ok = WriteLevelFile(levelPath.c_str(), data, pixels, StampLevelSource(imagePath.c_str()));
+
+        UnloadImageColors(pixels);
+        UnloadImage(image);
+        auto t1 = std::chrono::steady_clock::now();
+
+        if (!ok) {
+            printf("❌ %s: gagal nulis %s\n", imagePath.c_str(), levelPath.c_str());
+            failures++;
+            continue;
+        }
+        printf("✅ %s -> %s | %dx%d | solid %d | spawns player %d enemy %d | breakable px %d | %.1f ms\n",
+               imagePath.c_str(), levelPath.c_str(), data.width, data.height, data.solid.CountSet(),
+               (int)data.playerSpawns.size(), (int)data.enemySpawns.size(),
+               data.breakable.CountSet(),
+               std::chrono::duration<double, std::milli>(t1 - t0).count());
+    }
+    return failures > 0 ? 1 : 0;
+}
@@ -1,8 +1,29 @@
 #include "Game.h"
+#include <cstring>
+#include <cstdlib>
 
-int main() {
-    Game game(1280, 720);
-    game.Run();
+int main(int argc, char** argv) {
+    // --headless --waves N --ticks N --seed N --god --weapon 0-3 --profile out.csv
+    // --ai-budget N (maks update musuh jauh per tick) --no-ai-lod
+    HeadlessConfig headless;
+    AiLodConfig aiLod;
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = (i + 1 < argc);
+        if (strcmp(argv[i], "--headless") == 0) headless.enabled = true;
+        else if (strcmp(argv[i], "--god") == 0) headless.godMode = true;
+        else if (strcmp(argv[i], "--waves") == 0 && hasValue) headless.targetWave = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--ticks") == 0 && hasValue) headless.maxTicks = atol(argv[++i]);
+        else if (strcmp(argv[i], "--seed") == 0 && hasValue) headless.seed = (unsigned int)strtoul(argv[++i], nullptr, 10);
+        else if (strcmp(argv[i], "--weapon") == 0 && hasValue) headless.weapon = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--profile") == 0 && hasValue) headless.profileCsv = argv[++i];
+        else if (strcmp(argv[i], "--ai-budget") == 0 && hasValue) aiLod.updateBudget = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--no-ai-lod") == 0) aiLod.enabled = false;
+    }
+
+    Game game(1280, 720, headless);
+    game.SetAiLod(aiLod);
+    if (headless.enabled) game.RunHeadless();
+    else game.Run();
 
     return 0;
-}
\ No newline at end of file
+}